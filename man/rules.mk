@@ -50,4 +50,5 @@ dist_man1_MANS += \
     man/fev2xml.1 \
     man/fixnwn2xml.1 \
     man/unobb.1 \
+    man/archdiff.1 \
     $(EMPTY)
@@ -0,0 +1,375 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Tool to compare the contents of two archives.
+ */
+
+#include <cstdio>
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <future>
+
+#include "src/version/version.h"
+
+#include "src/common/ustring.h"
+#include "src/common/util.h"
+#include "src/common/strutil.h"
+#include "src/common/error.h"
+#include "src/common/platform.h"
+#include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
+#include "src/common/filepath.h"
+#include "src/common/md5.h"
+#include "src/common/threadpool.h"
+#include "src/common/cli.h"
+
+#include "src/aurora/util.h"
+#include "src/aurora/aurorafile.h"
+#include "src/aurora/archive.h"
+#include "src/aurora/erffile.h"
+#include "src/aurora/rimfile.h"
+#include "src/aurora/zipfile.h"
+#include "src/aurora/keyfile.h"
+#include "src/aurora/biffile.h"
+#include "src/aurora/bzffile.h"
+
+#include "src/archives/util.h"
+
+#include "src/util.h"
+
+/** All archives making up one side of the comparison. */
+struct ArchiveSet {
+	std::vector<std::unique_ptr<Aurora::KEYFile>> keys;
+	std::vector<std::unique_ptr<Aurora::Archive>> archives;
+};
+
+/** A resource within an archive set. */
+struct Resource {
+	Common::UString path; ///< The resource's path, as extracted by the archive tools.
+
+	const Aurora::Archive *archive; ///< The archive containing the resource.
+	uint32_t index;                 ///< The resource's index within the archive.
+	uint64_t size;                  ///< The resource's decompressed size.
+};
+
+/** All resources of an archive set, by lowercased path. */
+typedef std::map<Common::UString, Resource> ResourceMap;
+
+/** The difference found for a resource. */
+struct Change {
+	char type;            ///< 'A'dded, 'D'eleted, 'M'odified or ' ' for not yet known.
+	Common::UString path; ///< The resource's path.
+
+	/** The MD5 digests of both versions of the resource, if their sizes are equal. */
+	std::shared_future<std::vector<byte>> oldDigest, newDigest;
+};
+
+bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
+                      Common::UString &oldArchive, Common::UString &newArchive,
+                      uint32_t &jobs, Common::UString &names);
+
+void openArchives(const Common::UString &file, ArchiveSet &archives);
+void collectResources(const ArchiveSet &archives, ResourceMap &resources);
+
+bool diffResources(const ResourceMap &oldResources, const ResourceMap &newResources, uint32_t jobs);
+
+int main(int argc, char **argv) {
+	initPlatform();
+
+	try {
+		std::vector<Common::UString> args;
+		Common::Platform::getParameters(argc, argv, args);
+
+		int returnValue = 1;
+		Common::UString oldArchive, newArchive;
+		uint32_t jobs = 1;
+		Common::UString names;
+
+		if (!parseCommandLine(args, returnValue, oldArchive, newArchive, jobs, names))
+			return returnValue;
+
+		if (!names.empty())
+			Archives::loadNameDictionary(names);
+
+		ArchiveSet oldArchives, newArchives;
+		openArchives(oldArchive, oldArchives);
+		openArchives(newArchive, newArchives);
+
+		ResourceMap oldResources, newResources;
+		collectResources(oldArchives, oldResources);
+		collectResources(newArchives, newResources);
+
+		if (!diffResources(oldResources, newResources, jobs))
+			return 1;
+
+	} catch (...) {
+		Common::exceptionDispatcherError();
+	}
+
+	return 0;
+}
+
+bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
+                      Common::UString &oldArchive, Common::UString &newArchive,
+                      uint32_t &jobs, Common::UString &names) {
+
+	using Common::CLI::NoOption;
+	using Common::CLI::kContinueParsing;
+	using Common::CLI::Parser;
+	using Common::CLI::ValGetter;
+	using Common::CLI::makeEndArgs;
+
+	NoOption oldOpt(false, new ValGetter<Common::UString &>(oldArchive, "old archive"));
+	NoOption newOpt(false, new ValGetter<Common::UString &>(newArchive, "new archive"));
+	Parser parser(argv[0], "Archive comparison tool",
+	              "Lists the files added (A), deleted (D) and modified (M) between\n"
+	              "two archives. An archive can be an ERF, RIM or ZIP file, or a KEY\n"
+	              "file, together with the BIF/BZF files it indexes.\n",
+	              returnValue,
+	              makeEndArgs(&oldOpt, &newOpt));
+
+	parser.addSpace();
+	parser.addOption("jobs", 'j', "Hash files using this many threads in parallel "
+	                 "(0: one per CPU core)", kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+	parser.addOption("names", "Resolve hashed file names using this list of "
+	                 "additional file names, one per line", kContinueParsing,
+	                 new ValGetter<Common::UString &>(names, "file"));
+
+	return parser.process(argv);
+}
+
+/** Find a BIF/BZF file indexed by a KEY, relative to the KEY's directory.
+ *
+ *  The case of the path is ignored, and mobile ports replacing the BIF
+ *  files with BZF files are taken into account.
+ */
+static Common::UString findDataFile(const Common::UString &keyDirectory, Common::UString dataFile) {
+	dataFile.replaceAll('\\', '/');
+
+	const Common::UString directory =
+		Common::FilePath::findSubDirectory(keyDirectory, Common::FilePath::getDirectory(dataFile), true);
+	if (directory.empty())
+		return "";
+
+	const Common::UString fileName = Common::FilePath::getFile(dataFile);
+
+	const Common::UString candidates[] = {
+		fileName, fileName.toLower(), fileName.toUpper(),
+		Common::FilePath::changeExtension(fileName, ".bzf"),
+		Common::FilePath::changeExtension(fileName, ".bzf").toLower(),
+		Common::FilePath::changeExtension(fileName, ".bzf").toUpper()
+	};
+
+	for (size_t i = 0; i < ARRAYSIZE(candidates); i++) {
+		const Common::UString path = directory + "/" + candidates[i];
+		if (Common::FilePath::isRegularFile(path))
+			return path;
+	}
+
+	return "";
+}
+
+static void openKEY(const Common::UString &keyFile, ArchiveSet &archives) {
+	Common::ReadFile keyStream(keyFile);
+
+	archives.keys.emplace_back(std::make_unique<Aurora::KEYFile>(keyStream));
+	const Aurora::KEYFile &key = *archives.keys.back();
+
+	Common::UString keyDirectory = Common::FilePath::getDirectory(keyFile);
+	if (keyDirectory.empty())
+		keyDirectory = ".";
+
+	const Aurora::KEYFile::BIFList &bifs = key.getBIFs();
+	for (size_t i = 0; i < bifs.size(); i++) {
+		const Common::UString dataFile = findDataFile(keyDirectory, bifs[i]);
+		if (dataFile.empty()) {
+			warning("\"%s\" indexed by \"%s\" not found", bifs[i].c_str(), keyFile.c_str());
+			continue;
+		}
+
+		std::unique_ptr<Aurora::KEYDataFile> data;
+		if (Common::FilePath::getExtension(dataFile).equalsIgnoreCase(".bzf"))
+			data = std::make_unique<Aurora::BZFFile>(new Common::MappedFile(dataFile));
+		else
+			data = std::make_unique<Aurora::BIFFile>(new Common::MappedFile(dataFile));
+
+		data->mergeKEY(key, i);
+
+		archives.archives.emplace_back(std::move(data));
+	}
+}
+
+void openArchives(const Common::UString &file, ArchiveSet &archives) {
+	try {
+		std::unique_ptr<Common::SeekableReadStream> stream = std::make_unique<Common::MappedFile>(file);
+
+		const uint32_t id = Aurora::AuroraFile::readHeaderID(*stream);
+		stream->seek(0);
+
+		switch (id) {
+			case MKTAG('E', 'R', 'F', ' '):
+			case MKTAG('M', 'O', 'D', ' '):
+			case MKTAG('H', 'A', 'K', ' '):
+			case MKTAG('S', 'A', 'V', ' '):
+			case MKTAG('N', 'W', 'M', ' '):
+				archives.archives.emplace_back(std::make_unique<Aurora::ERFFile>(stream.release()));
+				break;
+
+			case MKTAG('R', 'I', 'M', ' '):
+				archives.archives.emplace_back(std::make_unique<Aurora::RIMFile>(stream.release()));
+				break;
+
+			case MKTAG('K', 'E', 'Y', ' '):
+				stream.reset();
+				openKEY(file, archives);
+				break;
+
+			case MKTAG('B', 'I', 'F', 'F'):
+				throw Common::Exception("BIF/BZF files need to be compared through their KEY file");
+
+			default:
+				if ((id >> 16) != MKTAG_16('P', 'K'))
+					throw Common::Exception("Unknown archive type %s", Common::debugTag(id).c_str());
+
+				archives.archives.emplace_back(std::make_unique<Aurora::ZIPFile>(stream.release()));
+				break;
+		}
+
+	} catch (Common::Exception &e) {
+		e.add("Failed opening archive \"%s\"", file.c_str());
+		throw;
+	}
+}
+
+void collectResources(const ArchiveSet &archives, ResourceMap &resources) {
+	// Resources found in several archives are taken from the last of them, like the games do
+	for (const auto &archive : archives.archives) {
+		const Aurora::Archive::ResourceList &list = archive->getResources();
+
+		for (Aurora::Archive::ResourceList::const_iterator r = list.begin(); r != list.end(); ++r) {
+			Resource resource;
+
+			resource.path    = Archives::findPath(r->name, r->type, r->hash, archive->getNameHashAlgo());
+			resource.archive = archive.get();
+			resource.index   = r->index;
+			resource.size    = archive->getResourceSize(r->index);
+
+			resources[resource.path.toLower()] = resource;
+		}
+	}
+}
+
+static std::shared_future<std::vector<byte>> hashResource(Common::ThreadPool &pool, const Resource &resource) {
+	const Aurora::Archive *archive = resource.archive;
+	const uint32_t index = resource.index;
+
+	return pool.addJob([archive, index]() {
+		std::unique_ptr<Common::ReadStream> stream(archive->getResourceStream(index, true));
+
+		std::vector<byte> digest;
+		Common::hashMD5(*stream, digest);
+
+		return digest;
+	}).share();
+}
+
+bool diffResources(const ResourceMap &oldResources, const ResourceMap &newResources, uint32_t jobs) {
+	Common::ThreadPool pool(jobs);
+
+	std::vector<Change> changes;
+
+	/* Walk over both sorted maps at once. Only resources with the same size in
+	 * both archives need to be decompressed and hashed, and this happens in
+	 * parallel while we're still going through the list. */
+
+	ResourceMap::const_iterator o = oldResources.begin();
+	ResourceMap::const_iterator n = newResources.begin();
+	while ((o != oldResources.end()) || (n != newResources.end())) {
+		Change change;
+
+		if ((n == newResources.end()) || ((o != oldResources.end()) && (o->first < n->first))) {
+			change.type = 'D';
+			change.path = (o++)->second.path;
+
+		} else if ((o == oldResources.end()) || (n->first < o->first)) {
+			change.type = 'A';
+			change.path = (n++)->second.path;
+
+		} else {
+			change.type = (o->second.size != n->second.size) ? 'M' : ' ';
+			change.path = n->second.path;
+
+			if (change.type == ' ') {
+				change.oldDigest = hashResource(pool, o->second);
+				change.newDigest = hashResource(pool, n->second);
+			}
+
+			++o;
+			++n;
+		}
+
+		changes.push_back(change);
+	}
+
+	bool success = true;
+	size_t added = 0, deleted = 0, modified = 0, unchanged = 0;
+
+	for (std::vector<Change>::iterator c = changes.begin(); c != changes.end(); ++c) {
+		if (c->type == ' ') {
+			try {
+				if (c->oldDigest.get() != c->newDigest.get())
+					c->type = 'M';
+
+			} catch (...) {
+				// We can't tell whether the resource changed, so better treat it as modified
+				c->type = 'M';
+
+				// This includes std::bad_alloc, for a resource with a broken size
+				Common::exceptionDispatcherWarnAndIgnore("Failed comparing \"" + c->path + "\"");
+
+				success = false;
+			}
+		}
+
+		if      (c->type == 'A')
+			added++;
+		else if (c->type == 'D')
+			deleted++;
+		else if (c->type == 'M')
+			modified++;
+		else
+			unchanged++;
+
+		if (c->type != ' ')
+			std::printf("%c %s\n", c->type, c->path.c_str());
+	}
+
+	std::fflush(stdout);
+
+	status("%s added, %s deleted, %s modified, %s unchanged",
+	       Common::composeString(added).c_str(), Common::composeString(deleted).c_str(),
+	       Common::composeString(modified).c_str(), Common::composeString(unchanged).c_str());
+
+	return success;
+}
@@ -0,0 +1,132 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A user-supplied dictionary of file names, to resolve hashed names.
+ */
+
+#include <algorithm>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/readstream.h"
+#include "src/common/readfile.h"
+#include "src/common/encoding.h"
+
+#include "src/archives/namedictionary.h"
+
+namespace Archives {
+
+NameDictionary::HashIndex::HashIndex() : built(false) {
+}
+
+
+NameDictionary::NameDictionary() {
+}
+
+NameDictionary::~NameDictionary() {
+}
+
+size_t NameDictionary::size() const {
+	return _offsets.size();
+}
+
+void NameDictionary::add(const Common::UString &name) {
+	if (name.empty())
+		return;
+
+	if ((_names.size() + name.size() + 1) > 0xFFFFFFFF)
+		throw Common::Exception("Name dictionary too large");
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_offsets.push_back(_names.size());
+	_names.insert(_names.end(), name.c_str(), name.c_str() + name.size() + 1);
+
+	for (size_t i = 0; i < ARRAYSIZE(_indices); i++)
+		_indices[i].built = false;
+}
+
+void NameDictionary::load(Common::SeekableReadStream &stream) {
+	while (!stream.eos()) {
+		Common::UString line = Common::readStringLine(stream, Common::kEncodingUTF8);
+
+		line.trim();
+		if (line.empty() || (*line.begin() == '#'))
+			continue;
+
+		add(line);
+	}
+}
+
+void NameDictionary::load(const Common::UString &fileName) {
+	Common::ReadFile file(fileName);
+
+	load(file);
+}
+
+void NameDictionary::buildIndex(HashIndex &index, Common::HashAlgo algo) const {
+	std::vector< std::pair<uint64_t, uint32_t> > sorted;
+	sorted.reserve(_offsets.size());
+
+	for (std::vector<uint32_t>::const_iterator o = _offsets.begin(); o != _offsets.end(); ++o) {
+		const Common::UString name(&_names[*o]);
+
+		sorted.push_back(std::make_pair(Common::hashString(name.toLower(), algo), *o));
+	}
+
+	// On duplicate hashes, the name that was added first wins
+	std::stable_sort(sorted.begin(), sorted.end(),
+		[](const std::pair<uint64_t, uint32_t> &a, const std::pair<uint64_t, uint32_t> &b) {
+			return a.first < b.first;
+	});
+
+	index.hashes.clear();
+	index.offsets.clear();
+
+	index.hashes.reserve(sorted.size());
+	index.offsets.reserve(sorted.size());
+
+	for (std::vector< std::pair<uint64_t, uint32_t> >::const_iterator s = sorted.begin(); s != sorted.end(); ++s) {
+		index.hashes.push_back(s->first);
+		index.offsets.push_back(s->second);
+	}
+
+	index.built = true;
+}
+
+const char *NameDictionary::find(uint64_t hash, Common::HashAlgo algo) const {
+	if (((size_t) algo) >= ARRAYSIZE(_indices))
+		return 0;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	HashIndex &index = _indices[algo];
+	if (!index.built)
+		buildIndex(index, algo);
+
+	std::vector<uint64_t>::const_iterator h = std::lower_bound(index.hashes.begin(), index.hashes.end(), hash);
+	if ((h == index.hashes.end()) || (*h != hash))
+		return 0;
+
+	return &_names[index.offsets[h - index.hashes.begin()]];
+}
+
+} // End of namespace Archives
@@ -0,0 +1,104 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A user-supplied dictionary of file names, to resolve hashed names.
+ */
+
+#ifndef ARCHIVES_NAMEDICTIONARY_H
+#define ARCHIVES_NAMEDICTIONARY_H
+
+#include <vector>
+#include <mutex>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/hash.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Archives {
+
+/** A dictionary of file names, resolving hashes of these names back to the names.
+ *
+ *  All names are kept in one packed string pool. For each hash algorithm, a
+ *  sorted array of hashes, together with the pool offsets of the names, is
+ *  built on the first lookup with that algorithm, so that resolving a hash
+ *  is a binary search over a contiguous array.
+ *
+ *  Names are hashed in their lowercase form.
+ */
+class NameDictionary : boost::noncopyable {
+public:
+	NameDictionary();
+	~NameDictionary();
+
+	/** Return the number of names in this dictionary. */
+	size_t size() const;
+
+	/** Add a name to this dictionary. */
+	void add(const Common::UString &name);
+
+	/** Add all names found in a text stream, one name per line.
+	 *
+	 *  Leading and trailing whitespace is ignored, as are empty lines
+	 *  and lines starting with a '#'.
+	 */
+	void load(Common::SeekableReadStream &stream);
+
+	/** Add all names found in a text file, one name per line. */
+	void load(const Common::UString &fileName);
+
+	/** Find the name that hashes to this value with this algorithm.
+	 *
+	 *  The returned pointer stays valid until the next name is added.
+	 *
+	 *  @return The name, or 0 if no name in the dictionary has that hash.
+	 */
+	const char *find(uint64_t hash, Common::HashAlgo algo) const;
+
+private:
+	/** A sorted index over all names, for one hash algorithm. */
+	struct HashIndex {
+		bool built;
+
+		std::vector<uint64_t> hashes;  ///< The hashes of all names, sorted.
+		std::vector<uint32_t> offsets; ///< The offsets of the names, in the same order.
+
+		HashIndex();
+	};
+
+	std::vector<char> _names;       ///< All names, NUL-terminated and packed together.
+	std::vector<uint32_t> _offsets; ///< The offsets of the names within the pool.
+
+	mutable HashIndex _indices[Common::kHashMAX];
+
+	mutable std::mutex _mutex;
+
+	void buildIndex(HashIndex &index, Common::HashAlgo algo) const;
+};
+
+} // End of namespace Archives
+
+#endif // ARCHIVES_NAMEDICTIONARY_H
@@ -25,11 +25,13 @@ src_archives_libarchives_la_SOURCES =
 src_archives_libarchives_la_SOURCES += \
     src/archives/files_dragonage.h \
     src/archives/files_sonic.h \
+    src/archives/namedictionary.h \
     src/archives/util.h \
     $(EMPTY)
 
 src_archives_libarchives_la_SOURCES += \
     src/archives/files_dragonage.cpp \
     src/archives/files_sonic.cpp \
+    src/archives/namedictionary.cpp \
     src/archives/util.cpp \
     $(EMPTY)
@@ -25,29 +25,51 @@
 #include <cstdio>
 
 #include <vector>
+#include <map>
 #include <memory>
+#include <future>
 
 #include "src/common/util.h"
 #include "src/common/strutil.h"
 #include "src/common/error.h"
 #include "src/common/hash.h"
+#include "src/common/md5.h"
 #include "src/common/filepath.h"
+#include "src/common/platform.h"
 #include "src/common/readstream.h"
+#include "src/common/memreadstream.h"
 #include "src/common/writefile.h"
+#include "src/common/stdoutstream.h"
+#include "src/common/tarwriter.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/util.h"
 #include "src/aurora/archive.h"
 #include "src/aurora/keyfile.h"
+#include "src/aurora/keydatafile.h"
 #include "src/aurora/nsbtxfile.h"
 
 #include "src/archives/util.h"
 #include "src/archives/files_dragonage.h"
 #include "src/archives/files_sonic.h"
+#include "src/archives/namedictionary.h"
 
 namespace Archives {
 
-static Common::UString findPath(const Common::UString &name, Aurora::FileType type,
-                                uint64_t hash, Common::HashAlgo algo) {
+/** Additional file names supplied by the user. */
+static NameDictionary userNames;
+
+void loadNameDictionary(const Common::UString &fileName) {
+	try {
+		userNames.load(fileName);
+	} catch (Common::Exception &e) {
+		e.add("Failed loading name dictionary \"%s\"", fileName.c_str());
+		throw;
+	}
+}
+
+Common::UString findPath(const Common::UString &name, Aurora::FileType type,
+                         uint64_t hash, Common::HashAlgo algo) {
 
 	Common::UString path;
 
@@ -66,6 +88,12 @@ static Common::UString findPath(const Common::UString &name, Aurora::FileType ty
 			path = fromSonicHash;
 	}
 
+	if (path.empty()) {
+		const char * const fromUserHash = userNames.find(hash, algo);
+		if (fromUserHash)
+			path = fromUserHash;
+	}
+
 	if (path.empty())
 		path = TypeMan.addFileType(Common::formatHash(hash), type);
 
@@ -77,10 +105,10 @@ static Common::UString findPath(const Common::UString &name, Aurora::FileType ty
 struct FileEntry {
 	Common::UString file;
 	Common::UString ext;
-	uint32_t size;
+	uint64_t size;
 	uint32_t bifIndex;
 
-	FileEntry(const Common::UString &f = "", const Common::UString &e = "", uint32_t s = 0xFFFFFFFF) :
+	FileEntry(const Common::UString &f = "", const Common::UString &e = "", uint64_t s = 0xFFFFFFFF) :
 		file(f), ext(e), size(s), bifIndex(0xFFFFFFFF) { }
 };
 
@@ -118,9 +146,11 @@ void listFiles(const Aurora::Archive &archive, Aurora::GameID game, bool directo
 
 	for (std::vector<FileEntry>::const_iterator f = fileEntries.begin(); f != fileEntries.end(); ++f) {
 		if (directories)
-			std::printf("%-*s| %10d\n", static_cast<int>(namePrintLength), f->file.c_str(), f->size);
+			std::printf("%-*s| %10s\n", static_cast<int>(namePrintLength), f->file.c_str(),
+			            Common::composeString(f->size).c_str());
 		else
-			std::printf("%*s%-*s | %10d\n", static_cast<int>(namePrintLength - extLength - 1), f->file.c_str(), static_cast<int>(extLength), f->ext.c_str(), f->size);
+			std::printf("%*s%-*s | %10s\n", static_cast<int>(namePrintLength - extLength - 1), f->file.c_str(),
+			            static_cast<int>(extLength), f->ext.c_str(), Common::composeString(f->size).c_str());
 	}
 }
 
@@ -182,7 +212,7 @@ void listFiles(const Aurora::NSBTXFile &nsbtx) {
 		std::printf("%16s.tga\n", r->name.c_str());
 }
 
-static void dumpStream(Common::SeekableReadStream &stream, const Common::UString &fileName) {
+static void dumpStream(Common::ReadStream &stream, const Common::UString &fileName) {
 	Common::WriteFile file;
 	if (!file.open(fileName))
 		throw Common::Exception(Common::kOpenError);
@@ -193,8 +223,92 @@ static void dumpStream(Common::SeekableReadStream &stream, const Common::UString
 	file.close();
 }
 
+/** A resource extraction running on a worker thread. */
+struct ExtractJob {
+	size_t number;         ///< The 1-based number of the resource within the archive.
+	Common::UString name;  ///< The name of the file the resource is extracted to.
+
+	std::shared_future<void> result; ///< Finishes when the file has been written.
+};
+
+static void extractFilesParallel(const Aurora::Archive &archive, Aurora::GameID game, bool directories,
+                                 const std::set<Common::UString> &files, size_t threadCount) {
+
+	const Aurora::Archive::ResourceList &resources = archive.getResources();
+	const size_t fileCount = resources.size();
+
+	std::printf("Number of files: %s\n\n", Common::composeString(fileCount).c_str());
+
+	Common::ThreadPool pool(threadCount);
+
+	std::vector<ExtractJob> jobs;
+	jobs.reserve(fileCount);
+
+	/* Several resources might end up in the same file. To get the same result as
+	 * when extracting serially, these are written in archive order, each job
+	 * waiting for the previous write to the same file to finish. */
+	std::map<Common::UString, std::shared_future<void>> lastWrite;
+
+	size_t i = 1;
+	for (Aurora::Archive::ResourceList::const_iterator r = resources.begin(); r != resources.end(); ++r, ++i) {
+		const Aurora::FileType type = TypeMan.aliasFileType(r->type, game);
+
+		const Common::UString path     = findPath(r->name, type, r->hash, archive.getNameHashAlgo());
+		const Common::UString fileName = Common::FilePath::getFile(path);
+		const Common::UString dirName  = Common::FilePath::getDirectory(path);
+		const Common::UString name     = directories ? path : fileName;
+
+		if (!files.empty() && (files.find(name) == files.end()))
+			continue;
+
+		if (directories && !dirName.empty())
+			Common::FilePath::createDirectories(dirName);
+
+		const uint32_t index = r->index;
+		const std::shared_future<void> previous = lastWrite[name];
+
+		ExtractJob job;
+		job.number = i;
+		job.name   = name;
+		job.result = pool.addJob([&archive, index, name, previous]() {
+			if (previous.valid())
+				previous.wait();
+
+			// Sub streams of the archive don't move its position, so we can avoid copying here too
+			std::unique_ptr<Common::ReadStream> stream(archive.getResourceStream(index, true));
+
+			dumpStream(*stream, name);
+		}).share();
+
+		lastWrite[name] = job.result;
+		jobs.push_back(job);
+	}
+
+	for (std::vector<ExtractJob>::const_iterator j = jobs.begin(); j != jobs.end(); ++j) {
+		std::printf("Extracting %s/%s: %s ... ", Common::composeString(j->number).c_str(),
+		                                         Common::composeString(fileCount).c_str(),
+		                                         j->name.c_str());
+
+		try {
+			j->result.get();
+
+			std::printf("Done\n");
+		} catch (Common::Exception &e) {
+			std::fflush(stdout);
+			Common::printException(e, "");
+		}
+	}
+
+	std::fflush(stdout);
+}
+
 void extractFiles(const Aurora::Archive &archive, Aurora::GameID game, bool directories,
-                  const std::set<Common::UString> &files) {
+                  const std::set<Common::UString> &files, size_t threadCount) {
+
+	if (threadCount != 1) {
+		extractFilesParallel(archive, game, directories, files, threadCount);
+		return;
+	}
 
 	const Aurora::Archive::ResourceList &resources = archive.getResources();
 	const size_t fileCount = resources.size();
@@ -222,7 +336,8 @@ void extractFiles(const Aurora::Archive &archive, Aurora::GameID game, bool dire
 		std::fflush(stdout);
 
 		try {
-			std::unique_ptr<Common::SeekableReadStream> stream(archive.getResource(r->index));
+			// We only read one resource at a time here, so we can avoid copying it
+			std::unique_ptr<Common::ReadStream> stream(archive.getResourceStream(r->index, true));
 
 			dumpStream(*stream, name);
 
@@ -233,6 +348,226 @@ void extractFiles(const Aurora::Archive &archive, Aurora::GameID game, bool dire
 	}
 }
 
+bool extractFilesTar(const Aurora::Archive &archive, Aurora::GameID game, bool directories,
+                     const std::set<Common::UString> &files) {
+
+	const Aurora::Archive::ResourceList &resources = archive.getResources();
+	const size_t fileCount = resources.size();
+
+	// stdout carries the tar archive, so all messages go to stderr
+	std::fprintf(stderr, "Number of files: %s\n\n", Common::composeString(fileCount).c_str());
+
+	Common::Platform::setStdOutBinary();
+
+	Common::StdOutStream out;
+	Common::TarWriter tar(out);
+
+	bool success = true;
+
+	size_t i = 1;
+	for (Aurora::Archive::ResourceList::const_iterator r = resources.begin(); r != resources.end(); ++r, ++i) {
+		const Aurora::FileType type = TypeMan.aliasFileType(r->type, game);
+
+		const Common::UString path     = findPath(r->name, type, r->hash, archive.getNameHashAlgo());
+		const Common::UString fileName = Common::FilePath::getFile(path);
+		const Common::UString name     = directories ? path : fileName;
+
+		if (!files.empty() && (files.find(name) == files.end()))
+			continue;
+
+		std::fprintf(stderr, "Extracting %s/%s: %s ... ", Common::composeString(i).c_str(),
+		                                                  Common::composeString(fileCount).c_str(),
+		                                                  name.c_str());
+		std::fflush(stderr);
+
+		try {
+			// Decompress the resource on the fly, directly into the tar archive
+			std::unique_ptr<Common::ReadStream> stream(archive.getResourceStream(r->index, true));
+
+			tar.add(name, *stream, archive.getResourceSize(r->index));
+
+			std::fprintf(stderr, "Done\n");
+		} catch (Common::Exception &e) {
+			Common::printException(e, "");
+			success = false;
+		}
+	}
+
+	tar.finish();
+
+	return success;
+}
+
+/** A stream calculating the CRC32 and size of all data read through it. */
+class CRC32ReadStream : public Common::ReadStream {
+public:
+	CRC32ReadStream(Common::ReadStream &stream) : _stream(&stream), _crc(0xFFFFFFFF), _size(0) {
+	}
+
+	bool eos() const {
+		return _stream->eos();
+	}
+
+	size_t read(void *dataPtr, size_t dataSize) {
+		const size_t bytesRead = _stream->read(dataPtr, dataSize);
+
+		const byte *data = reinterpret_cast<const byte *>(dataPtr);
+		for (size_t i = 0; i < bytesRead; i++)
+			_crc = Common::hashCRC32(_crc, data[i]);
+
+		_size += bytesRead;
+
+		return bytesRead;
+	}
+
+	uint32_t getCRC32() const {
+		return _crc ^ 0xFFFFFFFF;
+	}
+
+	uint64_t getSize() const {
+		return _size;
+	}
+
+private:
+	Common::ReadStream *_stream;
+
+	uint32_t _crc;
+	uint64_t _size;
+};
+
+/** The checksums of a resource, as calculated by hashFiles(). */
+struct ResourceChecksums {
+	std::vector<byte> md5;
+	uint32_t crc32;
+	uint64_t size;
+};
+
+bool hashFiles(const Aurora::Archive &archive, Aurora::GameID game, bool directories,
+               const std::set<Common::UString> &files, size_t threadCount) {
+
+	const Aurora::Archive::ResourceList &resources = archive.getResources();
+
+	Common::ThreadPool pool(threadCount);
+
+	std::vector<Common::UString> names;
+	std::vector<std::future<ResourceChecksums>> checksums;
+
+	for (Aurora::Archive::ResourceList::const_iterator r = resources.begin(); r != resources.end(); ++r) {
+		const Aurora::FileType type = TypeMan.aliasFileType(r->type, game);
+
+		const Common::UString path     = findPath(r->name, type, r->hash, archive.getNameHashAlgo());
+		const Common::UString fileName = Common::FilePath::getFile(path);
+		const Common::UString name     = directories ? path : fileName;
+
+		if (!files.empty() && (files.find(name) == files.end()))
+			continue;
+
+		const uint32_t index = r->index;
+
+		names.push_back(name);
+		checksums.push_back(pool.addJob([&archive, index]() {
+			// Hash the decompressed data straight from the stream, without keeping it around
+			std::unique_ptr<Common::ReadStream> stream(archive.getResourceStream(index, true));
+			CRC32ReadStream crcStream(*stream);
+
+			ResourceChecksums result;
+			Common::hashMD5(crcStream, result.md5);
+
+			result.crc32 = crcStream.getCRC32();
+			result.size  = crcStream.getSize();
+
+			return result;
+		}));
+	}
+
+	bool success = true;
+	for (size_t i = 0; i < checksums.size(); i++) {
+		try {
+			const ResourceChecksums result = checksums[i].get();
+
+			for (std::vector<byte>::const_iterator m = result.md5.begin(); m != result.md5.end(); ++m)
+				std::printf("%02x", *m);
+
+			std::printf(" %08x %s %s\n", result.crc32, Common::composeString(result.size).c_str(),
+			            names[i].c_str());
+
+		} catch (...) {
+			/* Not only our own exceptions: a broken size field might also make
+			 * the allocation of a huge buffer throw std::bad_alloc. */
+			std::printf("FAILED - - %s\n", names[i].c_str());
+			std::fflush(stdout);
+
+			Common::exceptionDispatcherWarnAndIgnore("Failed hashing \"" + names[i] + "\"");
+
+			success = false;
+		}
+	}
+
+	std::fflush(stdout);
+
+	return success;
+}
+
+/** The amount of resource data read at once when extracting KEY data files in batches. */
+static const size_t kExtractBatchSize = 32 * 1024 * 1024;
+
+void extractFiles(const Aurora::KEYDataFile &keyData, Aurora::GameID game, Common::ThreadPool &pool) {
+	const Aurora::Archive::ResourceList &resources = keyData.getResources();
+	const size_t fileCount = resources.size();
+
+	std::printf("Number of files: %s\n\n", Common::composeString(fileCount).c_str());
+
+	size_t i = 1;
+
+	Aurora::Archive::ResourceList::const_iterator r = resources.begin();
+	while (r != resources.end()) {
+		// Collect resources until the batch is large enough, but always at least one
+
+		Aurora::KEYDataFile::ResourceBufferList batch;
+		std::vector<Common::UString> names;
+		std::vector<size_t> sizes;
+
+		size_t batchSize = 0;
+		for (; (r != resources.end()) && (batch.empty() || (batchSize < kExtractBatchSize)); ++r) {
+			const Aurora::FileType type = TypeMan.aliasFileType(r->type, game);
+
+			const Common::UString path = findPath(r->name, type, r->hash, keyData.getNameHashAlgo());
+
+			batch.push_back(Aurora::KEYDataFile::ResourceBuffer(r->index));
+			names.push_back(Common::FilePath::getFile(path));
+			sizes.push_back(keyData.getResourceSize(r->index));
+
+			batchSize += sizes.back();
+		}
+
+		std::unique_ptr<byte[]> data = std::make_unique<byte[]>(batchSize);
+
+		for (size_t j = 0, offset = 0; j < batch.size(); offset += sizes[j++])
+			batch[j].data = data.get() + offset;
+
+		keyData.readResources(batch, pool);
+
+		for (size_t j = 0; j < batch.size(); j++, i++) {
+			std::printf("Extracting %s/%s: %s ... ", Common::composeString(i).c_str(),
+			                                         Common::composeString(fileCount).c_str(),
+			                                         names[j].c_str());
+			std::fflush(stdout);
+
+			try {
+				if (batch[j].error)
+					std::rethrow_exception(batch[j].error);
+
+				Common::MemoryReadStream stream(batch[j].data, sizes[j]);
+				dumpStream(stream, names[j]);
+
+				std::printf("Done\n");
+			} catch (Common::Exception &e) {
+				Common::printException(e, "");
+			}
+		}
+	}
+}
+
 void extractFiles(const Aurora::NSBTXFile &nsbtx, const std::set<Common::UString> &files,
                   void (*dumper)(Common::SeekableReadStream &stream, const Common::UString &fileName)) {
 
@@ -28,18 +28,39 @@
 #include <set>
 
 #include "src/common/ustring.h"
+#include "src/common/hash.h"
 
 #include "src/aurora/types.h"
 
+namespace Common {
+	class ThreadPool;
+}
+
 namespace Aurora {
 	class Archive;
 
 	class KEYFile;
+	class KEYDataFile;
 	class NSBTXFile;
 }
 
 namespace Archives {
 
+/** Load a list of additional file names, one per line, to resolve hashed names with.
+ *
+ *  When listing or extracting an archive that only stores hashes of its file
+ *  names, these names are consulted after the built-in lists of known names.
+ */
+void loadNameDictionary(const Common::UString &fileName);
+
+/** Return the path of a resource, as listed and extracted by the archive tools.
+ *
+ *  Resources without a name are looked up by their hash in the built-in lists
+ *  of known names and the loaded name dictionary.
+ */
+Common::UString findPath(const Common::UString &name, Aurora::FileType type,
+                         uint64_t hash, Common::HashAlgo algo);
+
 /** List all files found in this archive on stdout.
  *
  *  @param archive The archive to list the contents of.
@@ -61,9 +82,57 @@ void listFiles(const Aurora::NSBTXFile &nsbtx);
  *         will be written directly into the current directory.
  *  @param files A list of files to extract. If empty, all files from the archive will be
  *         extracted.
+ *  @param threadCount The number of worker threads decompressing and writing files in
+ *         parallel. If 0, one thread per hardware thread is used. Progress is always
+ *         printed in archive order, and the extracted files are the same either way.
  */
 void extractFiles(const Aurora::Archive &archive, Aurora::GameID game, bool directories,
-                  const std::set<Common::UString> &files);
+                  const std::set<Common::UString> &files, size_t threadCount = 1);
+
+/** Write files from an archive as a tar archive to stdout.
+ *
+ *  Each resource is decompressed straight into the tar stream, without any
+ *  temporary files or directories. Progress is printed to stderr instead.
+ *
+ *  @param archive The archive to extract from.
+ *  @param game The game to alias types with.
+ *  @param directories Keep directories in the file names? If false, directories will be stripped.
+ *  @param files A list of files to extract. If empty, all files from the archive will be
+ *         extracted.
+ *  @return true if all files were extracted successfully.
+ */
+bool extractFilesTar(const Aurora::Archive &archive, Aurora::GameID game, bool directories,
+                     const std::set<Common::UString> &files);
+
+/** Hash files from an archive, printing a manifest of their checksums to stdout.
+ *
+ *  Each file is decompressed and hashed with both MD5 and CRC32 in a single
+ *  pass. Every line of the manifest has the form "<md5> <crc32> <size> <name>",
+ *  in archive order. For files that failed to decompress, the line reads
+ *  "FAILED - - <name>" instead, and the error is printed to stderr.
+ *
+ *  @param archive The archive to hash the files of.
+ *  @param game The game to alias types with.
+ *  @param directories Keep directories in the file names? If false, directories will be stripped.
+ *  @param files A list of files to hash. If empty, all files from the archive will be hashed.
+ *  @param threadCount The number of worker threads hashing files in parallel. If 0,
+ *         one thread per hardware thread is used.
+ *  @return true if all files were hashed successfully.
+ */
+bool hashFiles(const Aurora::Archive &archive, Aurora::GameID game, bool directories,
+               const std::set<Common::UString> &files, size_t threadCount = 1);
+
+/** Extract all files from a KEY data file, reading them in batches on a thread pool.
+ *
+ *  The resources of each batch are read at once with KEYDataFile::readResources(),
+ *  then written in archive order. This way, decompressing many small resources,
+ *  as found in BZF files, is spread over the worker threads of the pool.
+ *
+ *  @param keyData The KEY data file to extract from.
+ *  @param game The game to alias types with.
+ *  @param pool The thread pool to read the resources with.
+ */
+void extractFiles(const Aurora::KEYDataFile &keyData, Aurora::GameID game, Common::ThreadPool &pool);
 
 /** Extract files from an NSBTX. */
 void extractFiles(const Aurora::NSBTXFile &nsbtx, const std::set<Common::UString> &files,
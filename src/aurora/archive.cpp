@@ -22,7 +22,10 @@
  *  Handling various archive files.
  */
 
+#include <boost/functional/hash.hpp>
+
 #include "src/common/system.h"
+#include "src/common/readstream.h"
 
 #include "src/aurora/archive.h"
 
@@ -31,37 +34,110 @@ namespace Aurora {
 Archive::Resource::Resource() : hash(0), type(kFileTypeNone), index(0xFFFFFFFF) {
 }
 
-Archive::Archive() {
+Archive::Archive() : _hasIndex(false) {
 }
 
 Archive::~Archive() {
 }
 
-uint32_t Archive::getResourceSize(uint32_t UNUSED(index)) const {
+uint64_t Archive::getResourceSize(uint32_t UNUSED(index)) const {
 	return 0xFFFFFFFF;
 }
 
+Common::ReadStream *Archive::getResourceStream(uint32_t index, bool tryNoCopy) const {
+	return getResource(index, tryNoCopy);
+}
+
 Common::HashAlgo Archive::getNameHashAlgo() const {
 	return Common::kHashNone;
 }
 
+size_t Archive::hashResourceName::operator()(const ResourceName &name) const {
+	size_t seed = Common::hashUStringCaseInsensitive()(name.first);
+
+	boost::hash_combine(seed, static_cast<int>(name.second));
+
+	return seed;
+}
+
+bool Archive::equalResourceName::operator()(const ResourceName &name1, const ResourceName &name2) const {
+	return (name1.second == name2.second) && name1.first.equalsIgnoreCase(name2.first);
+}
+
+void Archive::invalidateResourceIndex() {
+	std::lock_guard<std::mutex> lock(_indexMutex);
+
+	_hashIndex.clear();
+	_nameIndex.clear();
+
+	_hasIndex = false;
+}
+
+void Archive::buildResourceIndex() const {
+	if (_hasIndex)
+		return;
+
+	const ResourceList &resources = getResources();
+	const bool hashed = getNameHashAlgo() != Common::kHashNone;
+
+	_hashIndex.clear();
+	_nameIndex.clear();
+
+	if (hashed)
+		_hashIndex.reserve(resources.size());
+	_nameIndex.reserve(resources.size());
+
+	// Insertion doesn't overwrite, so the first of several matching resources wins
+	for (ResourceList::const_iterator r = resources.begin(); r != resources.end(); ++r) {
+		if (hashed)
+			_hashIndex.insert(std::make_pair(r->hash, r->index));
+
+		_nameIndex.insert(std::make_pair(ResourceName(r->name, r->type), r->index));
+	}
+
+	_hasIndex = true;
+}
+
+uint32_t Archive::findResourceIndexed(const ResourceName &name) const {
+	NameIndex::const_iterator r = _nameIndex.find(name);
+	if (r == _nameIndex.end())
+		return 0xFFFFFFFF;
+
+	return r->second;
+}
+
 uint32_t Archive::findResource(uint64_t hash) const {
 	if (getNameHashAlgo() == Common::kHashNone)
 		return 0xFFFFFFFF;
 
-	for (ResourceList::const_iterator r = getResources().begin(); r != getResources().end(); ++r)
-		if (r->hash == hash)
-			return r->index;
+	std::lock_guard<std::mutex> lock(_indexMutex);
+	buildResourceIndex();
 
-	return 0xFFFFFFFF;
+	HashIndex::const_iterator r = _hashIndex.find(hash);
+	if (r == _hashIndex.end())
+		return 0xFFFFFFFF;
+
+	return r->second;
 }
 
 uint32_t Archive::findResource(const Common::UString &name, FileType type) const {
-	for (ResourceList::const_iterator r = getResources().begin(); r != getResources().end(); ++r)
-		if ((r->type == type) && (r->name == name))
-			return r->index;
+	std::lock_guard<std::mutex> lock(_indexMutex);
+	buildResourceIndex();
 
-	return 0xFFFFFFFF;
+	return findResourceIndexed(ResourceName(name, type));
+}
+
+std::vector<uint32_t> Archive::findResources(const std::vector<ResourceName> &names) const {
+	std::vector<uint32_t> indices;
+	indices.reserve(names.size());
+
+	std::lock_guard<std::mutex> lock(_indexMutex);
+	buildResourceIndex();
+
+	for (std::vector<ResourceName>::const_iterator n = names.begin(); n != names.end(); ++n)
+		indices.push_back(findResourceIndexed(*n));
+
+	return indices;
 }
 
 } // End of namespace Aurora
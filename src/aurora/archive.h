@@ -26,8 +26,12 @@
 #define AURORA_ARCHIVE_H
 
 #include <list>
+#include <vector>
+#include <utility>
+#include <mutex>
 
 #include <boost/noncopyable.hpp>
+#include <boost/unordered/unordered_map.hpp>
 
 #include "src/common/types.h"
 #include "src/common/ustring.h"
@@ -36,6 +40,7 @@
 #include "src/aurora/types.h"
 
 namespace Common {
+	class ReadStream;
 	class SeekableReadStream;
 }
 
@@ -56,6 +61,9 @@ public:
 
 	typedef std::list<Resource> ResourceList;
 
+	/** A resource's name and type, to look up several resources at once. */
+	typedef std::pair<Common::UString, FileType> ResourceName;
+
 	Archive();
 	virtual ~Archive();
 
@@ -63,23 +71,77 @@ public:
 	virtual const ResourceList &getResources() const = 0;
 
 	/** Return the size of a resource. */
-	virtual uint32_t getResourceSize(uint32_t index) const;
+	virtual uint64_t getResourceSize(uint32_t index) const;
 
 	/** Return a stream of the resource's contents.
+	 *
+	 *  This may be called from several threads at once. The archive is read
+	 *  with readAt(), so the returned streams can be read at the same time, too.
 	 *
 	 *  @param  index The index of the resource we want.
-	 *  @param  tryNoCopy Try to return a SeekableSubReadStream of the archive instead of copying.
+	 *  @param  tryNoCopy Try to return a sub stream of the archive instead of copying.
 	 *  @return A (sub)stream of the resource's contents.
 	 */
 	virtual Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const = 0;
 
+	/** Return a forward-only stream of the resource's contents.
+	 *
+	 *  Archives with compressed resources may decompress them on the fly,
+	 *  while the stream is read, instead of decompressing them into memory
+	 *  all at once. By default, this is the same as getResource().
+	 *
+	 *  @param  index The index of the resource we want.
+	 *  @param  tryNoCopy Try to return a sub stream of the archive instead of copying.
+	 *  @return A stream of the resource's contents.
+	 */
+	virtual Common::ReadStream *getResourceStream(uint32_t index, bool tryNoCopy = false) const;
+
 	/** Return with which algorithm the name is hashed. */
 	virtual Common::HashAlgo getNameHashAlgo() const;
 
 	/** Return the index of the resource matching the hash, or 0xFFFFFFFF if not found. */
 	uint32_t findResource(uint64_t hash) const;
-	/** Return the index of the resource matching the name and type, or 0xFFFFFFFF if not found. */
+	/** Return the index of the resource matching the name and type, or 0xFFFFFFFF if not found.
+	 *
+	 *  The name is compared case-insensitively.
+	 */
 	uint32_t findResource(const Common::UString &name, FileType type) const;
+
+	/** Return the indices of all the resources matching the names and types.
+	 *
+	 *  The returned list is parallel to the list of names. A resource that
+	 *  wasn't found has an index of 0xFFFFFFFF.
+	 */
+	std::vector<uint32_t> findResources(const std::vector<ResourceName> &names) const;
+
+protected:
+	/** Drop the lookup index, because the resource list changed. */
+	void invalidateResourceIndex();
+
+private:
+	struct hashResourceName {
+		size_t operator()(const ResourceName &name) const;
+	};
+
+	struct equalResourceName {
+		bool operator()(const ResourceName &name1, const ResourceName &name2) const;
+	};
+
+	typedef boost::unordered_map<uint64_t, uint32_t> HashIndex;
+	typedef boost::unordered_map<ResourceName, uint32_t, hashResourceName, equalResourceName> NameIndex;
+
+	/** Guards the lazily built lookup index. */
+	mutable std::mutex _indexMutex;
+
+	mutable bool _hasIndex;
+
+	mutable HashIndex _hashIndex; ///< Resource indices by hashed name.
+	mutable NameIndex _nameIndex; ///< Resource indices by name and type.
+
+	/** Build the lookup index, if necessary. _indexMutex must be held. */
+	void buildResourceIndex() const;
+	/** Look up a resource by name and type. _indexMutex must be held. */
+	uint32_t findResourceIndexed(const ResourceName &name) const;
 };
 
 } // End of namespace Aurora
@@ -32,9 +32,12 @@
 #include "src/common/strutil.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
+#include "src/common/writestream.h"
+#include "src/common/encoding.h"
 
 #include "src/aurora/biffile.h"
 #include "src/aurora/keyfile.h"
+#include "src/aurora/util.h"
 
 static const uint32_t kBIFID     = MKTAG('B', 'I', 'F', 'F');
 static const uint32_t kVersion1  = MKTAG('V', '1', ' ', ' ');
@@ -48,6 +51,12 @@ BIFFile::BIFFile(Common::SeekableReadStream *bif) : _bif(bif) {
 	load(*_bif);
 }
 
+BIFFile::BIFFile(Common::SeekableReadStream *bif, Common::SeekableReadStream &index) : _bif(bif) {
+	assert(_bif);
+
+	readIndex(index);
+}
+
 BIFFile::~BIFFile() {
 }
 
@@ -98,10 +107,10 @@ void BIFFile::readVarResTable(Common::SeekableReadStream &bif, uint32_t offset)
 
 void BIFFile::mergeKEY(const KEYFile &key, uint32_t dataFileIndex) {
 	const KEYFile::ResourceList &keyResList = key.getResources();
+	const KEYFile::ResourceIndexList &keyResIndices = key.getBIFResources(dataFileIndex);
 
-	for (KEYFile::ResourceList::const_iterator keyRes = keyResList.begin(); keyRes != keyResList.end(); ++keyRes) {
-		if (keyRes->bifIndex != dataFileIndex)
-			continue;
+	for (KEYFile::ResourceIndexList::const_iterator i = keyResIndices.begin(); i != keyResIndices.end(); ++i) {
+		const KEYFile::Resource * const keyRes = &keyResList[*i];
 
 		if (keyRes->resIndex >= _iResources.size()) {
 			warning("Resource index out of range (%d/%d)", keyRes->resIndex, (int) _iResources.size());
@@ -121,6 +130,58 @@ void BIFFile::mergeKEY(const KEYFile &key, uint32_t dataFileIndex) {
 		_resources.push_back(res);
 	}
 
+	invalidateResourceIndex();
+}
+
+void BIFFile::writeIndex(Common::WriteStream &index) const {
+	index.writeUint32BE(_id);
+	index.writeUint32BE(_version);
+
+	index.writeUint32LE(_iResources.size());
+	for (IResourceList::const_iterator res = _iResources.begin(); res != _iResources.end(); ++res) {
+		index.writeUint32LE((uint32_t) res->type);
+		index.writeUint32LE(res->offset);
+		index.writeUint32LE(res->size);
+	}
+
+	index.writeUint32LE(_resources.size());
+	for (ResourceList::const_iterator res = _resources.begin(); res != _resources.end(); ++res) {
+		Common::writeString(index, res->name, Common::kEncodingUTF8, true);
+
+		index.writeUint32LE((uint32_t) res->type);
+		index.writeUint32LE(res->index);
+	}
+}
+
+void BIFFile::readIndex(Common::SeekableReadStream &index) {
+	_id      = index.readUint32BE();
+	_version = index.readUint32BE();
+
+	if (_id != kBIFID)
+		throw Common::Exception("Not a BIF index (%s)", Common::debugTag(_id).c_str());
+
+	// Three uint32s per internal resource
+	_iResources.resize(readIndexCount(index, 12));
+	for (IResourceList::iterator res = _iResources.begin(); res != _iResources.end(); ++res) {
+		res->type   = (FileType) index.readUint32LE();
+		res->offset = index.readUint32LE();
+		res->size   = index.readUint32LE();
+	}
+
+	// A resource takes at least the terminating 0 byte of its name and two uint32s
+	_resources.resize(readIndexCount(index, 9));
+	for (ResourceList::iterator res = _resources.begin(); res != _resources.end(); ++res) {
+		res->name = Common::readString(index, Common::kEncodingUTF8);
+
+		res->type  = (FileType) index.readUint32LE();
+		res->index = index.readUint32LE();
+
+		if (res->index >= _iResources.size())
+			throw Common::Exception("BIF index resource out of range (%u/%u)",
+			                        res->index, (uint)_iResources.size());
+	}
+
+	invalidateResourceIndex();
 }
 
 uint32_t BIFFile::getInternalResourceCount() const {
@@ -138,7 +199,7 @@ const BIFFile::IResource &BIFFile::getIResource(uint32_t index) const {
 	return _iResources[index];
 }
 
-uint32_t BIFFile::getResourceSize(uint32_t index) const {
+uint64_t BIFFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).size;
 }
 
@@ -146,11 +207,9 @@ Common::SeekableReadStream *BIFFile::getResource(uint32_t index, bool tryNoCopy)
 	const IResource &res = getIResource(index);
 
 	if (tryNoCopy)
-		return new Common::SeekableSubReadStream(_bif.get(), res.offset, res.offset + res.size);
-
-	_bif->seek(res.offset);
+		return _bif->getSubStream(res.offset, res.offset + res.size);
 
-	return _bif->readStream(res.size);
+	return _bif->readStreamAt(res.offset, res.size);
 }
 
 } // End of namespace Aurora
@@ -72,6 +72,8 @@ class BIFFile : public KEYDataFile, public AuroraFile {
 public:
 	/** Take over this stream and read a BIF file out of it. */
 	BIFFile(Common::SeekableReadStream *bif);
+	/** Take over this stream, with the resource index read from a stream written by writeIndex(). */
+	BIFFile(Common::SeekableReadStream *bif, Common::SeekableReadStream &index);
 	~BIFFile();
 
 	/** Return the number of internal resources (including unmerged ones). */
@@ -81,7 +83,7 @@ public:
 	const ResourceList &getResources() const;
 
 	/** Return the size of a resource. */
-	uint32_t getResourceSize(uint32_t index) const;
+	uint64_t getResourceSize(uint32_t index) const;
 
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
@@ -96,13 +98,16 @@ public:
 	 */
 	void mergeKEY(const KEYFile &key, uint32_t dataFileIndex);
 
+	/** Write the resource index of this data file into a stream. */
+	void writeIndex(Common::WriteStream &index) const;
+
 private:
 	/** Internal resource information. */
 	struct IResource {
 		FileType type; ///< The resource's type.
 
-		uint32_t offset; ///< The offset of the resource within the BIF.
-		uint32_t size;   ///< The resource's size.
+		uint64_t offset; ///< The offset of the resource within the BIF.
+		uint64_t size;   ///< The resource's size.
 	};
 
 	typedef std::vector<IResource> IResourceList;
@@ -118,6 +123,8 @@ private:
 	void load(Common::SeekableReadStream &bif);
 	void readVarResTable(Common::SeekableReadStream &bif, uint32_t offset);
 
+	void readIndex(Common::SeekableReadStream &index);
+
 	const IResource &getIResource(uint32_t index) const;
 };
 
@@ -25,14 +25,19 @@
 
 #include "src/aurora/bifwriter.h"
 #include "src/aurora/types.h"
+#include "src/aurora/deduplicator.h"
 
 static const uint32_t kBIFFID = MKTAG('B', 'I', 'F', 'F');
 static const uint32_t kV1ID  = MKTAG('V', '1', ' ', ' ');
 
 namespace Aurora {
 
-BIFWriter::BIFWriter(uint32_t fileCount, Common::SeekableWriteStream &writeStream) :
+BIFWriter::BIFWriter(uint32_t fileCount, Common::SeekableWriteStream &writeStream, bool deduplicate) :
 		_maxFiles(fileCount), _currentFiles(0), _dataOffset(0), _writer(writeStream) {
+
+	if (deduplicate)
+		_deduplicator = std::make_unique<ResourceDeduplicator>();
+
 	// Write id and version.
 	writeStream.writeUint32BE(kBIFFID);
 	writeStream.writeUint32BE(kV1ID);
@@ -44,6 +49,9 @@ BIFWriter::BIFWriter(uint32_t fileCount, Common::SeekableWriteStream &writeStrea
 	writeStream.writeZeros(fileCount * 16);
 }
 
+BIFWriter::~BIFWriter() {
+}
+
 uint32_t BIFWriter::size() {
 	_writer.seek(0, Common::SeekableWriteStream::kOriginEnd);
 	return _writer.pos();
@@ -53,19 +61,43 @@ void BIFWriter::add(Common::SeekableReadStream &data, Aurora::FileType type) {
 	if (_currentFiles >= _maxFiles)
 		throw Common::Exception("BIFWriter::add() Attempt to write more files than maximum");
 
-	_writer.seek(0, Common::SeekableWriteStream::kOriginEnd);
-	size_t fileSize = _writer.writeStream(data);
+	const uint32_t duplicate = _deduplicator ?
+		_deduplicator->find(data, _currentFiles) : ResourceDeduplicator::kNoDuplicate;
+
+	uint32_t offset   = 20 + _maxFiles * 16 + _dataOffset;
+	uint32_t fileSize = 0;
+
+	if (duplicate != ResourceDeduplicator::kNoDuplicate) {
+		// Point to the data of the identical file written before
+		const ResourceDeduplicator::Location location = _deduplicator->reuseLocation(duplicate);
+
+		offset   = location.offset;
+		fileSize = location.size;
+
+	} else {
+		_writer.seek(0, Common::SeekableWriteStream::kOriginEnd);
+		fileSize = _writer.writeStream(data);
+
+		if (_deduplicator)
+			_deduplicator->setLocation(_currentFiles, offset, fileSize);
+
+		_dataOffset += fileSize;
+	}
+
 	data.seek(0);
 
 	_writer.seek(20 + _currentFiles * 16);
 
 	_writer.writeUint32LE(_currentFiles); // Index
-	_writer.writeUint32LE(20 + _maxFiles * 16 + _dataOffset); // Data offset
+	_writer.writeUint32LE(offset); // Data offset
 	_writer.writeUint32LE(fileSize); // File size
 	_writer.writeUint32LE(type); // Type
 
 	++_currentFiles;
-	_dataOffset += fileSize;
+}
+
+uint64_t BIFWriter::getBytesSaved() const {
+	return _deduplicator ? _deduplicator->getBytesSaved() : 0;
 }
 
 } // End of namespace Aurora
@@ -26,6 +26,8 @@
 #ifndef AURORA_BIFWRITER_H
 #define AURORA_BIFWRITER_H
 
+#include <memory>
+
 #include "src/common/writestream.h"
 #include "src/common/readstream.h"
 #include "src/common/types.h"
@@ -35,6 +37,8 @@
 
 namespace Aurora {
 
+class ResourceDeduplicator;
+
 /**
  * The purpose of this class is to write a BIF file containing
  * every data added by add().
@@ -45,8 +49,10 @@ public:
 	 * Create a new BIF writer reserving place for fileCount files.
 	 * @param fileCount the count of files to reserve
 	 * @param writeStream the stream to write to
+	 * @param deduplicate write the data of identical files only once
 	 */
-	BIFWriter(uint32_t fileCount, Common::SeekableWriteStream &writeStream);
+	BIFWriter(uint32_t fileCount, Common::SeekableWriteStream &writeStream, bool deduplicate = false);
+	~BIFWriter();
 
 	/**
 	 * Add new data by stream to this BIF file and write also offset,
@@ -62,11 +68,15 @@ public:
 	 */
 	uint32_t size();
 
+	uint64_t getBytesSaved() const;
+
 private:
 	const uint32_t _maxFiles;
 	uint32_t _currentFiles;
 	uint32_t _dataOffset;
 	Common::SeekableWriteStream &_writer;
+
+	std::unique_ptr<ResourceDeduplicator> _deduplicator;
 };
 
 } // End of namespace Aurora
@@ -31,10 +31,13 @@
 #include "src/common/strutil.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
+#include "src/common/writestream.h"
+#include "src/common/encoding.h"
 #include "src/common/lzma.h"
 
 #include "src/aurora/bzffile.h"
 #include "src/aurora/keyfile.h"
+#include "src/aurora/util.h"
 
 static const uint32_t kBZFID     = MKTAG('B', 'I', 'F', 'F');
 static const uint32_t kVersion1  = MKTAG('V', '1', ' ', ' ');
@@ -47,6 +50,12 @@ BZFFile::BZFFile(Common::SeekableReadStream *bzf) : _bzf(bzf) {
 	load(*_bzf);
 }
 
+BZFFile::BZFFile(Common::SeekableReadStream *bzf, Common::SeekableReadStream &index) : _bzf(bzf) {
+	assert(_bzf);
+
+	readIndex(index);
+}
+
 BZFFile::~BZFFile() {
 }
 
@@ -90,20 +99,29 @@ void BZFFile::readVarResTable(Common::SeekableReadStream &bzf, uint32_t offset)
 		_iResources[i].size   = bzf.readUint32LE();
 		_iResources[i].type   = (FileType) bzf.readUint32LE();
 
+		// The packed sizes are derived from the offsets, so they have to be ascending
+		if ((i > 0) && (_iResources[i].offset <= _iResources[i - 1].offset))
+			throw Common::Exception("BZF resource offsets not ascending (%u <= %u)",
+			                        (uint)_iResources[i].offset, (uint)_iResources[i - 1].offset);
+
 		if (i > 0)
 			_iResources[i - 1].packedSize = _iResources[i].offset - _iResources[i - 1].offset;
 	}
 
-	if (!_iResources.empty())
+	if (!_iResources.empty()) {
+		if (_iResources.back().offset > bzf.size())
+			throw Common::Exception("BZF resource offset out of range (%u)", (uint)_iResources.back().offset);
+
 		_iResources.back().packedSize = bzf.size() - _iResources.back().offset;
+	}
 }
 
 void BZFFile::mergeKEY(const KEYFile &key, uint32_t dataFileIndex) {
 	const KEYFile::ResourceList &keyResList = key.getResources();
+	const KEYFile::ResourceIndexList &keyResIndices = key.getBIFResources(dataFileIndex);
 
-	for (KEYFile::ResourceList::const_iterator keyRes = keyResList.begin(); keyRes != keyResList.end(); ++keyRes) {
-		if (keyRes->bifIndex != dataFileIndex)
-			continue;
+	for (KEYFile::ResourceIndexList::const_iterator i = keyResIndices.begin(); i != keyResIndices.end(); ++i) {
+		const KEYFile::Resource * const keyRes = &keyResList[*i];
 
 		if (keyRes->resIndex >= _iResources.size()) {
 			warning("Resource index out of range (%d/%d)", keyRes->resIndex, (int) _iResources.size());
@@ -123,6 +141,60 @@ void BZFFile::mergeKEY(const KEYFile &key, uint32_t dataFileIndex) {
 		_resources.push_back(res);
 	}
 
+	invalidateResourceIndex();
+}
+
+void BZFFile::writeIndex(Common::WriteStream &index) const {
+	index.writeUint32BE(_id);
+	index.writeUint32BE(_version);
+
+	index.writeUint32LE(_iResources.size());
+	for (IResourceList::const_iterator res = _iResources.begin(); res != _iResources.end(); ++res) {
+		index.writeUint32LE((uint32_t) res->type);
+		index.writeUint32LE(res->offset);
+		index.writeUint32LE(res->size);
+		index.writeUint32LE(res->packedSize);
+	}
+
+	index.writeUint32LE(_resources.size());
+	for (ResourceList::const_iterator res = _resources.begin(); res != _resources.end(); ++res) {
+		Common::writeString(index, res->name, Common::kEncodingUTF8, true);
+
+		index.writeUint32LE((uint32_t) res->type);
+		index.writeUint32LE(res->index);
+	}
+}
+
+void BZFFile::readIndex(Common::SeekableReadStream &index) {
+	_id      = index.readUint32BE();
+	_version = index.readUint32BE();
+
+	if (_id != kBZFID)
+		throw Common::Exception("Not a BZF index (%s)", Common::debugTag(_id).c_str());
+
+	// Four uint32s per internal resource
+	_iResources.resize(readIndexCount(index, 16));
+	for (IResourceList::iterator res = _iResources.begin(); res != _iResources.end(); ++res) {
+		res->type   = (FileType) index.readUint32LE();
+		res->offset = index.readUint32LE();
+		res->size   = index.readUint32LE();
+		res->packedSize = index.readUint32LE();
+	}
+
+	// A resource takes at least the terminating 0 byte of its name and two uint32s
+	_resources.resize(readIndexCount(index, 9));
+	for (ResourceList::iterator res = _resources.begin(); res != _resources.end(); ++res) {
+		res->name = Common::readString(index, Common::kEncodingUTF8);
+
+		res->type  = (FileType) index.readUint32LE();
+		res->index = index.readUint32LE();
+
+		if (res->index >= _iResources.size())
+			throw Common::Exception("BZF index resource out of range (%u/%u)",
+			                        res->index, (uint)_iResources.size());
+	}
+
+	invalidateResourceIndex();
 }
 
 uint32_t BZFFile::getInternalResourceCount() const {
@@ -140,16 +212,35 @@ const BZFFile::IResource &BZFFile::getIResource(uint32_t index) const {
 	return _iResources[index];
 }
 
-uint32_t BZFFile::getResourceSize(uint32_t index) const {
+uint64_t BZFFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).size;
 }
 
 Common::SeekableReadStream *BZFFile::getResource(uint32_t index, bool UNUSED(tryNoCopy)) const {
 	const IResource &res = getIResource(index);
 
-	_bzf->seek(res.offset);
+	std::unique_ptr<byte[]> data = std::make_unique<byte[]>(res.size);
+
+	Common::LZMA1Decoder decoder;
+	readResource(res, data.get(), decoder);
+
+	return new Common::MemoryReadStream(data.release(), res.size, true);
+}
+
+void BZFFile::readResources(ResourceBufferList &resources, Common::ThreadPool &pool) const {
+	readResourcesParallel(resources, pool, [this]() -> ResourceReader {
+		std::shared_ptr<Common::LZMA1Decoder> decoder = std::make_shared<Common::LZMA1Decoder>();
+
+		return [this, decoder](ResourceBuffer &resource) {
+			readResource(getIResource(resource.index), resource.data, *decoder);
+		};
+	});
+}
+
+void BZFFile::readResource(const IResource &res, byte *data, Common::LZMA1Decoder &decoder) const {
+	std::unique_ptr<Common::MemoryReadStream> packed(_bzf->readStreamAt(res.offset, res.packedSize));
 
-	return Common::decompressLZMA1(*_bzf, res.packedSize, res.size, true);
+	decoder.decompress(packed->getData(), res.packedSize, data, res.size, true);
 }
 
 } // End of namespace Aurora
@@ -39,6 +39,7 @@
 
 namespace Common {
 	class SeekableReadStream;
+	class LZMA1Decoder;
 }
 
 namespace Aurora {
@@ -56,6 +57,8 @@ class BZFFile : public KEYDataFile, public AuroraFile {
 public:
 	/** Take over this stream and read a BZF file out of it. */
 	BZFFile(Common::SeekableReadStream *bzf);
+	/** Take over this stream, with the resource index read from a stream written by writeIndex(). */
+	BZFFile(Common::SeekableReadStream *bzf, Common::SeekableReadStream &index);
 	~BZFFile();
 
 	/** Return the number of internal resources (including unmerged ones). */
@@ -65,11 +68,14 @@ public:
 	const ResourceList &getResources() const;
 
 	/** Return the size of a resource. */
-	uint32_t getResourceSize(uint32_t index) const;
+	uint64_t getResourceSize(uint32_t index) const;
 
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
 
+	/** Decompress several resources at once, reusing one LZMA decoder per worker thread. */
+	void readResources(ResourceBufferList &resources, Common::ThreadPool &pool) const;
+
 	/** Merge information from the KEY into the data file.
 	 *
 	 *  Without this step, this data file archive does not contain any
@@ -80,15 +86,18 @@ public:
 	 */
 	void mergeKEY(const KEYFile &key, uint32_t dataFileIndex);
 
+	/** Write the resource index of this data file into a stream. */
+	void writeIndex(Common::WriteStream &index) const;
+
 private:
 	/** Internal resource information. */
 	struct IResource {
 		FileType type; ///< The resource's type.
 
-		uint32_t offset; ///< The offset of the resource within the BZF.
-		uint32_t size;   ///< The resource's size.
+		uint64_t offset; ///< The offset of the resource within the BZF.
+		uint64_t size;   ///< The resource's size.
 
-		uint32_t packedSize; ///< Raw, compressed data size.
+		uint64_t packedSize; ///< Raw, compressed data size.
 	};
 
 	typedef std::vector<IResource> IResourceList;
@@ -104,7 +113,12 @@ private:
 	void load(Common::SeekableReadStream &bzf);
 	void readVarResTable(Common::SeekableReadStream &bzf, uint32_t offset);
 
+	void readIndex(Common::SeekableReadStream &index);
+
 	const IResource &getIResource(uint32_t index) const;
+
+	/** Read and decompress a resource into a buffer of res.size bytes. */
+	void readResource(const IResource &res, byte *data, Common::LZMA1Decoder &decoder) const;
 };
 
 } // End of namespace Aurora
@@ -71,6 +71,11 @@ void BZFWriter::add(Common::SeekableReadStream &data, Aurora::FileType type) {
 	_dataOffset += stream->size();
 }
 
+uint64_t BZFWriter::getBytesSaved() const {
+	// BZF files can't share data between resources, see the class description
+	return 0;
+}
+
 uint32_t BZFWriter::size() {
 	_writer.seek(0, Common::SeekableWriteStream::kOriginEnd);
 	return _writer.pos();
@@ -33,7 +33,12 @@
 namespace Aurora {
 
 /**
- * This class handles the writing of
+ * This class handles the writing of BZF files.
+ *
+ * BZF resource tables don't store the compressed size of a resource.
+ * Readers take it from the distance to the next resource's data instead,
+ * so every resource needs its own copy of the data, in the order of the
+ * resource table. Deduplication is therefore not supported.
  */
 class BZFWriter : public KEYDataWriter {
 public:
@@ -43,6 +48,8 @@ public:
 
 	uint32_t size();
 
+	uint64_t getBytesSaved() const;
+
 private:
 	const uint32_t _maxFiles;
 	uint32_t _currentFiles;
@@ -0,0 +1,76 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Finding resources with identical data while writing archives.
+ */
+
+#include "src/common/error.h"
+#include "src/common/readstream.h"
+#include "src/common/md5.h"
+
+#include "src/aurora/deduplicator.h"
+
+namespace Aurora {
+
+ResourceDeduplicator::ResourceDeduplicator() : _bytesSaved(0) {
+}
+
+ResourceDeduplicator::~ResourceDeduplicator() {
+}
+
+uint32_t ResourceDeduplicator::find(Common::SeekableReadStream &data, uint32_t index) {
+	const size_t start = data.pos();
+
+	DataKey key;
+	key.first = data.size() - start;
+
+	Common::hashMD5(data, key.second);
+	data.seek(start);
+
+	std::pair<std::map<DataKey, uint32_t>::iterator, bool> result = _indices.insert(std::make_pair(key, index));
+	if (result.second)
+		return kNoDuplicate;
+
+	return result.first->second;
+}
+
+void ResourceDeduplicator::setLocation(uint32_t index, uint32_t offset, uint32_t size) {
+	Location &location = _locations[index];
+
+	location.offset = offset;
+	location.size   = size;
+}
+
+ResourceDeduplicator::Location ResourceDeduplicator::reuseLocation(uint32_t index) {
+	std::map<uint32_t, Location>::const_iterator location = _locations.find(index);
+	if (location == _locations.end())
+		throw Common::Exception("Resource %u hasn't been written yet", index);
+
+	_bytesSaved += location->second.size;
+
+	return location->second;
+}
+
+uint64_t ResourceDeduplicator::getBytesSaved() const {
+	return _bytesSaved;
+}
+
+} // End of namespace Aurora
@@ -0,0 +1,97 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Finding resources with identical data while writing archives.
+ */
+
+#ifndef AURORA_DEDUPLICATOR_H
+#define AURORA_DEDUPLICATOR_H
+
+#include <vector>
+#include <map>
+#include <utility>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Aurora {
+
+/** Finds resources whose data is identical to the data of a resource added earlier.
+ *
+ *  Archive writers use this to write identical data only once, letting all
+ *  entries of the resource table with that data point to the same offset.
+ *  The data of a resource is identified by its size and MD5 digest.
+ */
+class ResourceDeduplicator : boost::noncopyable {
+public:
+	static const uint32_t kNoDuplicate = 0xFFFFFFFF;
+
+	/** Where the data of a resource has been written to. */
+	struct Location {
+		uint32_t offset; ///< The offset of the data within the archive.
+		uint32_t size;   ///< The size of the data, as written into the archive.
+	};
+
+	ResourceDeduplicator();
+	~ResourceDeduplicator();
+
+	/** Find an earlier resource with the same data as the rest of this stream.
+	 *
+	 *  The stream is read to its end, and then seeked back to where it was.
+	 *
+	 *  @param  data The data of the new resource.
+	 *  @param  index The index of the new resource within the archive.
+	 *  @return The index of the earlier resource, or kNoDuplicate if the data
+	 *          is new. Then, the new resource is remembered under its index.
+	 */
+	uint32_t find(Common::SeekableReadStream &data, uint32_t index);
+
+	/** Remember where the data of a new resource has been written to. */
+	void setLocation(uint32_t index, uint32_t offset, uint32_t size);
+
+	/** Return where the data of an earlier resource has been written to.
+	 *
+	 *  The size of that data is counted as saved, because the duplicate
+	 *  doesn't need to be written again.
+	 */
+	Location reuseLocation(uint32_t index);
+
+	/** Return the number of bytes that didn't need to be written. */
+	uint64_t getBytesSaved() const;
+
+private:
+	/** The size and the MD5 digest of a resource's data. */
+	typedef std::pair<size_t, std::vector<byte>> DataKey;
+
+	std::map<DataKey, uint32_t> _indices;
+	std::map<uint32_t, Location> _locations;
+
+	uint64_t _bytesSaved;
+};
+
+} // End of namespace Aurora
+
+#endif // AURORA_DEDUPLICATOR_H
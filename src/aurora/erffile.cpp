@@ -304,9 +304,9 @@ void ERFFile::load() {
 void ERFFile::decryptNWNPremium() {
 	assert(_header.encryption == kEncryptionBlowfishNWN);
 
-	_erf->seek(0);
-
-	_erf.reset(decrypt(*_erf, kEncryptionBlowfishNWN, _password));
+	/* Instead of decrypting the whole archive up front, only decrypt
+	 * the parts of the archive we actually read. */
+	_erf.reset(Common::createBlowfishDecryptStream(_erf.release(), _password));
 
 	_header.encryption = kEncryptionNone;
 }
@@ -696,6 +696,30 @@ const LocString &ERFFile::getDescription() const {
 	return _description;
 }
 
+ERFFile::Encryption ERFFile::getEncryption() const {
+	return _header.encryption;
+}
+
+ERFFile::Compression ERFFile::getCompression() const {
+	return _header.compression;
+}
+
+uint32_t ERFFile::getDescriptionOffset() const {
+	return _header.offDescription;
+}
+
+uint32_t ERFFile::getDescriptionSize() const {
+	return _header.descriptionSize;
+}
+
+uint32_t ERFFile::getKeyListOffset() const {
+	return _header.offKeyList;
+}
+
+uint32_t ERFFile::getResourceListOffset() const {
+	return _header.offResList;
+}
+
 const Archive::ResourceList &ERFFile::getResources() const {
 	return _resources;
 }
@@ -707,27 +731,55 @@ const ERFFile::IResource &ERFFile::getIResource(uint32_t index) const {
 	return _iResources[index];
 }
 
-uint32_t ERFFile::getResourceSize(uint32_t index) const {
+uint64_t ERFFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).unpackedSize;
 }
 
+uint64_t ERFFile::getResourceOffset(uint32_t index) const {
+	return getIResource(index).offset;
+}
+
+uint64_t ERFFile::getResourcePackedSize(uint32_t index) const {
+	return getIResource(index).packedSize;
+}
+
 Common::SeekableReadStream *ERFFile::getResource(uint32_t index, bool tryNoCopy) const {
 	const IResource &res = getIResource(index);
 
 	if (tryNoCopy && (_header.encryption == kEncryptionNone) && (_header.compression == kCompressionNone))
-		return new Common::SeekableSubReadStream(_erf.get(), res.offset, res.offset + res.packedSize);
+		return _erf->getSubStream(res.offset, res.offset + res.packedSize);
+
+	// Decompress
+	return decompress(readPackedResource(res), res.unpackedSize);
+}
+
+Common::ReadStream *ERFFile::getResourceStream(uint32_t index, bool tryNoCopy) const {
+	switch (_header.compression) {
+		case kCompressionLZMA:
+		case kCompressionBioWareZlib:
+		case kCompressionHeaderlessZlib:
+		case kCompressionStandardZlib:
+			break;
 
-	_erf->seek(res.offset);
+		default:
+			return getResource(index, tryNoCopy);
+	}
+
+	const IResource &res = getIResource(index);
 
+	// Only the packed data is kept in memory, the unpacked data is streamed
+	return decompressStream(readPackedResource(res), res.unpackedSize);
+}
+
+Common::MemoryReadStream *ERFFile::readPackedResource(const IResource &res) const {
 	// Read
-	Common::MemoryReadStream *stream = _erf->readStream(res.packedSize);
+	Common::MemoryReadStream *stream = _erf->readStreamAt(res.offset, res.packedSize);
 
 	// Decrypt
 	if (_header.encryption != kEncryptionNone)
 		stream = decrypt(stream, _header.encryption, _password);
 
-	// Decompress
-	return decompress(stream, res.unpackedSize);
+	return stream;
 }
 
 Common::MemoryReadStream *ERFFile::decrypt(Common::SeekableReadStream &cryptStream,
@@ -766,7 +818,7 @@ Common::SeekableReadStream *ERFFile::decrypt(Common::SeekableReadStream &erf, si
 }
 
 Common::SeekableReadStream *ERFFile::decompress(Common::MemoryReadStream *packedStream,
-                                                uint32_t unpackedSize) const {
+                                                size_t unpackedSize) const {
 
 	std::unique_ptr<Common::MemoryReadStream> stream(packedStream);
 
@@ -799,8 +851,39 @@ Common::SeekableReadStream *ERFFile::decompress(Common::MemoryReadStream *packed
 	throw Common::Exception("Invalid ERF compression %u", (uint) _header.compression);
 }
 
+Common::ReadStream *ERFFile::decompressStream(Common::MemoryReadStream *packedStream,
+                                              size_t unpackedSize) const {
+
+	std::unique_ptr<Common::MemoryReadStream> stream(packedStream);
+
+	const size_t packedSize = stream->size();
+
+	switch (_header.compression) {
+		case kCompressionLZMA:
+			return Common::decompressERFLZMAStream(std::move(stream), packedSize, unpackedSize).release();
+
+		case kCompressionBioWareZlib: {
+			// An extra one byte header specifies the window size
+			const int windowBits = stream->readByte() >> 4;
+
+			return Common::decompressDeflateStream(stream.release(), packedSize - 1, unpackedSize, -windowBits);
+		}
+
+		case kCompressionHeaderlessZlib:
+			return Common::decompressDeflateStream(stream.release(), packedSize, unpackedSize, -Common::kWindowBitsMax);
+
+		case kCompressionStandardZlib:
+			return Common::decompressDeflateStream(stream.release(), packedSize, unpackedSize, Common::kWindowBitsMax);
+
+		default:
+			break;
+	}
+
+	return decompress(stream.release(), unpackedSize);
+}
+
 Common::SeekableReadStream *ERFFile::decompressBiowareZlib(Common::MemoryReadStream *packedStream,
-                                                           uint32_t unpackedSize) const {
+                                                           size_t unpackedSize) const {
 
 	/* Decompress using raw inflate. An extra one byte header specifies the window size. */
 
@@ -809,13 +892,13 @@ Common::SeekableReadStream *ERFFile::decompressBiowareZlib(Common::MemoryReadStr
 	std::unique_ptr<Common::MemoryReadStream> stream(packedStream);
 
 	const byte * const compressedData = stream->getData();
-	const uint32_t packedSize = stream->size();
+	const size_t packedSize = stream->size();
 
 	return decompressZlib(compressedData + 1, packedSize - 1, unpackedSize, *compressedData >> 4);
 }
 
 Common::SeekableReadStream *ERFFile::decompressHeaderlessZlib(Common::MemoryReadStream *packedStream,
-                                                              uint32_t unpackedSize) const {
+                                                              size_t unpackedSize) const {
 
 	/* Decompress using raw inflate. Use the default maximum window size (15). */
 
@@ -824,13 +907,13 @@ Common::SeekableReadStream *ERFFile::decompressHeaderlessZlib(Common::MemoryRead
 	std::unique_ptr<Common::MemoryReadStream> stream(packedStream);
 
 	const byte * const compressedData = stream->getData();
-	const uint32_t packedSize = stream->size();
+	const size_t packedSize = stream->size();
 
 	return decompressZlib(compressedData, packedSize, unpackedSize, Common::kWindowBitsMax);
 }
 
 Common::SeekableReadStream *ERFFile::decompressStandardZlib(Common::MemoryReadStream *packedStream,
-                                                            uint32_t unpackedSize) const {
+                                                            size_t unpackedSize) const {
 
 	/* Decompress using raw inflate. Use the default maximum window size (15), and with zlib header. */
 
@@ -839,13 +922,13 @@ Common::SeekableReadStream *ERFFile::decompressStandardZlib(Common::MemoryReadSt
 	std::unique_ptr<Common::MemoryReadStream> stream(packedStream);
 
 	const byte * const compressedData = stream->getData();
-	const uint32_t packedSize = stream->size();
+	const size_t packedSize = stream->size();
 
 	return decompressZlib(compressedData, packedSize, unpackedSize, -Common::kWindowBitsMax);
 }
 
-Common::SeekableReadStream *ERFFile::decompressZlib(const byte *compressedData, uint32_t packedSize,
-                                                    uint32_t unpackedSize, int windowBits) const {
+Common::SeekableReadStream *ERFFile::decompressZlib(const byte *compressedData, size_t packedSize,
+                                                    size_t unpackedSize, int windowBits) const {
 
 	// Decompress. Negative window size to signal not to look for a gzip header.
 	const byte *data = Common::decompressDeflate(compressedData, packedSize, unpackedSize, -windowBits);
@@ -854,12 +937,12 @@ Common::SeekableReadStream *ERFFile::decompressZlib(const byte *compressedData,
 }
 
 std::unique_ptr<Common::SeekableReadStream> ERFFile::decompressLZMA(std::unique_ptr<Common::SeekableReadStream> packedStream,
-                                                                    uint32_t unpackedSize) const {
+                                                                    size_t unpackedSize) const {
 	return Common::decompressERFLZMA(*packedStream, packedStream->size(), unpackedSize);
 }
 
 std::unique_ptr<Common::SeekableReadStream> ERFFile::decompressXboxLZX(std::unique_ptr<Common::SeekableReadStream> packedStream,
-	                                                                   uint32_t unpackedSize) const {
+	                                                                   size_t unpackedSize) const {
 	return Common::decompressXboxLZX(*packedStream, unpackedSize);
 }
 
@@ -104,6 +104,23 @@ namespace Aurora {
  */
 class ERFFile : public Archive, public AuroraFile {
 public:
+	enum Encryption {
+		kEncryptionNone        =  0, ///< No encryption at all.
+		kEncryptionXOR         =  1, ///< XOR encryption as used by V2.2 and V3.0 (UNSUPPORTED!)
+		kEncryptionBlowfishDAO =  2, ///< Blowfish encryption as used by Dragon Age: Origins (V2.2).
+		kEncryptionBlowfishDA2 =  3, ///< Blowfish encryption as used by Dragon Age II (V3.0).
+		kEncryptionBlowfishNWN = 16  ///< Blowfish encryption as used by Neverwinter Nights (V1.1).
+	};
+
+	enum Compression {
+		kCompressionNone           = 0, ///< No compression as all.
+		kCompressionBioWareZlib    = 1, ///< Compression using DEFLATE with an extra header byte.
+		kCompressionLZMA           = 2, ///< Compression using LZMA.
+		kCompressionXboxLZX        = 3, ///< Compression using Xbox 360 LZX.
+		kCompressionHeaderlessZlib = 7, ///< Compression using DEFLATE with default parameters.
+		kCompressionStandardZlib   = 8  ///< Compression using DEFLATE, standard zlib chunk.
+	};
+
 	/** Take over this stream and read an ERF file out of it.
 	 *
 	 *  When the ERF is encrypted, use this password to decrypt it.
@@ -124,11 +141,14 @@ public:
 	const ResourceList &getResources() const;
 
 	/** Return the size of a resource. */
-	uint32_t getResourceSize(uint32_t index) const;
+	uint64_t getResourceSize(uint32_t index) const;
 
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
 
+	/** Return a stream of the resource's contents, decompressing zlib and LZMA on the fly. */
+	Common::ReadStream *getResourceStream(uint32_t index, bool tryNoCopy = false) const;
+
 	/** Return the year the ERF was built. */
 	uint32_t getBuildYear() const;
 	/** Return the day of year the ERF was built. */
@@ -140,27 +160,29 @@ public:
 	/** Return with which algorithm the name is hashed. */
 	Common::HashAlgo getNameHashAlgo() const;
 
+	/** Return the encryption algorithm of the resource data. */
+	Encryption getEncryption() const;
+	/** Return the compression algorithm of the resource data. */
+	Compression getCompression() const;
+
+	/** Return the offset of the description within the ERF. */
+	uint32_t getDescriptionOffset() const;
+	/** Return the size of the description within the ERF. */
+	uint32_t getDescriptionSize() const;
+	/** Return the offset of the key list within the ERF. */
+	uint32_t getKeyListOffset() const;
+	/** Return the offset of the resource list within the ERF. */
+	uint32_t getResourceListOffset() const;
+
+	/** Return the offset of a resource's data within the ERF. */
+	uint64_t getResourceOffset(uint32_t index) const;
+	/** Return the size of a resource's data within the ERF, before decompression. */
+	uint64_t getResourcePackedSize(uint32_t index) const;
+
 	static LocString getDescription(Common::SeekableReadStream &erf);
 	static LocString getDescription(const Common::UString &fileName);
 
 private:
-	enum Encryption {
-		kEncryptionNone        =  0, ///< No encryption at all.
-		kEncryptionXOR         =  1, ///< XOR encryption as used by V2.2 and V3.0 (UNSUPPORTED!)
-		kEncryptionBlowfishDAO =  2, ///< Blowfish encryption as used by Dragon Age: Origins (V2.2).
-		kEncryptionBlowfishDA2 =  3, ///< Blowfish encryption as used by Dragon Age II (V3.0).
-		kEncryptionBlowfishNWN = 16  ///< Blowfish encryption as used by Neverwinter Nights (V1.1).
-	};
-
-	enum Compression {
-		kCompressionNone           = 0, ///< No compression as all.
-		kCompressionBioWareZlib    = 1, ///< Compression using DEFLATE with an extra header byte.
-		kCompressionLZMA           = 2, ///< Compression using LZMA.
-		kCompressionXboxLZX        = 3, ///< Compression using Xbox 360 LZX.
-		kCompressionHeaderlessZlib = 7, ///< Compression using DEFLATE with default parameters.
-		kCompressionStandardZlib   = 8  ///< Compression using DEFLATE, standard zlib chunk.
-	};
-
 	/** The header of an ERF file. */
 	struct ERFHeader {
 		uint32_t resCount;         ///< Number of resources in this ERF.
@@ -201,9 +223,9 @@ private:
 
 	/** Internal resource information. */
 	struct IResource {
-		uint32_t offset;       ///< The offset of the resource within the ERF.
-		uint32_t packedSize;   ///< The resource's packed size.
-		uint32_t unpackedSize; ///< The resource's unpacked size.
+		uint64_t offset;       ///< The offset of the resource within the ERF.
+		uint64_t packedSize;   ///< The resource's packed size.
+		uint64_t unpackedSize; ///< The resource's unpacked size.
 	};
 
 	typedef std::vector<IResource> IResourceList;
@@ -293,26 +315,31 @@ private:
 
 	// .--- Compression
 	Common::SeekableReadStream *decompress(Common::MemoryReadStream *packedStream,
-	                                       uint32_t unpackedSize) const;
+	                                       size_t unpackedSize) const;
+	Common::ReadStream *decompressStream(Common::MemoryReadStream *packedStream,
+	                                     size_t unpackedSize) const;
 
 	Common::SeekableReadStream *decompressBiowareZlib   (Common::MemoryReadStream *packedStream,
-	                                                     uint32_t unpackedSize) const;
+	                                                     size_t unpackedSize) const;
 	Common::SeekableReadStream *decompressHeaderlessZlib(Common::MemoryReadStream *packedStream,
-	                                                     uint32_t unpackedSize) const;
+	                                                     size_t unpackedSize) const;
 	Common::SeekableReadStream *decompressStandardZlib  (Common::MemoryReadStream *packedStream,
-	                                                     uint32_t unpackedSize) const;
+	                                                     size_t unpackedSize) const;
 
-	Common::SeekableReadStream *decompressZlib(const byte *compressedData, uint32_t packedSize,
-	                                           uint32_t unpackedSize, int windowBits) const;
+	Common::SeekableReadStream *decompressZlib(const byte *compressedData, size_t packedSize,
+	                                           size_t unpackedSize, int windowBits) const;
 
 	std::unique_ptr<Common::SeekableReadStream> decompressLZMA(std::unique_ptr<Common::SeekableReadStream> packedStream,
-	                                                           uint32_t unpackedSize) const;
+	                                                           size_t unpackedSize) const;
 
 	std::unique_ptr<Common::SeekableReadStream> decompressXboxLZX(std::unique_ptr<Common::SeekableReadStream> packedStream,
-	                                                              uint32_t unpackedSize) const;
+	                                                              size_t unpackedSize) const;
 	// '---
 
 	const IResource &getIResource(uint32_t index) const;
+
+	/** Read a resource's packed data and decrypt it. */
+	Common::MemoryReadStream *readPackedResource(const IResource &res) const;
 };
 
 } // End of namespace Aurora
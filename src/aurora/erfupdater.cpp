@@ -0,0 +1,401 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Updating existing BioWare's ERFs (encapsulated resource file) in place.
+ */
+
+#include <algorithm>
+#include <map>
+#include <memory>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/strutil.h"
+#include "src/common/encoding.h"
+#include "src/common/readfile.h"
+#include "src/common/memreadstream.h"
+#include "src/common/deflate.h"
+#include "src/common/filepath.h"
+
+#include "src/aurora/erfupdater.h"
+#include "src/aurora/erfwriter.h"
+#include "src/aurora/util.h"
+
+namespace Aurora {
+
+static const uint32_t kVersion10 = MKTAG('V', '1', '.', '0');
+static const uint32_t kVersion20 = MKTAG('V', '2', '.', '0');
+static const uint32_t kVersion22 = MKTAG('V', '2', '.', '2');
+
+/** The size of the V1.0 header, which is followed by the description. */
+static const uint32_t kV10HeaderSize = 160;
+
+/** The offset of the file count, in all supported versions. */
+static const uint32_t kFileCountOffset = 16;
+
+ERFUpdater::ERFUpdater(const Common::UString &fileName) : _fileName(fileName) {
+	try {
+		load();
+
+		if (!_file.open(_fileName, true))
+			throw Common::Exception("Can't open file \"%s\" for updating", _fileName.c_str());
+
+	} catch (Common::Exception &e) {
+		e.add("Failed opening ERF archive \"%s\" for updating", _fileName.c_str());
+		throw;
+	}
+}
+
+ERFUpdater::~ERFUpdater() {
+	try {
+		flush();
+	} catch (...) {
+	}
+}
+
+void ERFUpdater::load() {
+	const ERFFile erf(new Common::ReadFile(_fileName));
+
+	_version = erf.getVersion();
+	if ((_version != kVersion10) && (_version != kVersion20) && (_version != kVersion22))
+		throw Common::Exception("Unsupported ERF version %s", Common::debugTag(_version).c_str());
+
+	if (erf.getEncryption() != ERFFile::kEncryptionNone)
+		throw Common::Exception("Encrypted ERF archives can't be updated");
+
+	_compression = erf.getCompression();
+	if ((_compression != ERFFile::kCompressionNone) &&
+	    (_compression != ERFFile::kCompressionBioWareZlib) &&
+	    (_compression != ERFFile::kCompressionHeaderlessZlib))
+		throw Common::Exception("Unsupported ERF compression %u", (uint)_compression);
+
+	if (_version == kVersion10) {
+		_headerSize = MAX<uint32_t>(kV10HeaderSize, erf.getDescriptionOffset() + erf.getDescriptionSize());
+
+		_keyTableOffset = erf.getKeyListOffset();
+	} else
+		_headerSize = erf.getResourceListOffset();
+
+	const ERFFile::ResourceList &resources = erf.getResources();
+
+	_resourceTableOffset = erf.getResourceListOffset();
+	_tableCapacity       = resources.size();
+
+	_entries.resize(resources.size());
+
+	for (const auto &res : resources) {
+		Entry &entry = _entries[res.index];
+
+		entry.resRef  = res.name;
+		entry.resType = res.type;
+
+		entry.offset       = erf.getResourceOffset(res.index);
+		entry.packedSize   = erf.getResourcePackedSize(res.index);
+		entry.unpackedSize = erf.getResourceSize(res.index);
+	}
+
+	if (_version == kVersion10)
+		return;
+
+	/* Keep the full file names of V2.x archives, because a file
+	 * extension we don't know would get lost in the file type. */
+	Common::ReadFile file(_fileName);
+
+	const uint32_t entrySize = getResourceTableEntrySize();
+	for (size_t i = 0; i < _entries.size(); i++) {
+		file.seek(_resourceTableOffset + i * entrySize);
+
+		_entries[i].fileName = Common::readStringFixed(file, Common::kEncodingUTF16LE, 64);
+	}
+}
+
+size_t ERFUpdater::getFileCount() const {
+	return _entries.size();
+}
+
+ERFUpdater::Entry *ERFUpdater::findEntry(const Common::UString &resRef, FileType resType) {
+	for (auto &entry : _entries)
+		if ((entry.resType == resType) && entry.resRef.equalsIgnoreCase(resRef))
+			return &entry;
+
+	return 0;
+}
+
+uint32_t ERFUpdater::getResourceTableEntrySize() const {
+	if (_version == kVersion10)
+		return 8;
+
+	return (_version == kVersion20) ? 72 : 76;
+}
+
+uint32_t ERFUpdater::getTablesSize() const {
+	const uint32_t keyTableEntrySize = (_version == kVersion10) ? 24 : 0;
+
+	return _entries.size() * (keyTableEntrySize + getResourceTableEntrySize());
+}
+
+void ERFUpdater::add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
+	// The same types as ERFWriter::add() writes
+	if ((resType == kFileTypeNone) || (resType >= kFileTypeMAXArchive))
+		resType = kFileTypeRES;
+
+	Entry entry;
+	entry.resRef       = resRef;
+	entry.resType      = resType;
+	entry.fileName     = TypeMan.addFileType(resRef, resType);
+	entry.unpackedSize = stream.size();
+
+	_file.seek(0, Common::SeekableWriteStream::kOriginEnd);
+
+	entry.offset     = _file.pos();
+	entry.packedSize = appendData(stream);
+
+	Entry *existing = findEntry(resRef, resType);
+	if (existing)
+		*existing = entry;
+	else
+		_entries.push_back(entry);
+
+	_changed = true;
+}
+
+bool ERFUpdater::remove(const Common::UString &resRef, FileType resType) {
+	Entry *entry = findEntry(resRef, resType);
+	if (!entry)
+		return false;
+
+	_entries.erase(_entries.begin() + (entry - _entries.data()));
+
+	_changed = true;
+	return true;
+}
+
+uint32_t ERFUpdater::appendData(Common::SeekableReadStream &stream) {
+	if (_file.size() > 0xFFFFFFFF)
+		throw Common::Exception("ERF archive grew too big");
+
+	_file.seek(0, Common::SeekableWriteStream::kOriginEnd);
+
+	if (_compression == ERFFile::kCompressionNone)
+		return _file.writeStream(stream);
+
+	// Compress the same way ERFWriter does
+	uint32_t size = 0;
+
+	if (_compression == ERFFile::kCompressionBioWareZlib) {
+		_file.writeByte(static_cast<uint>(Common::kWindowBitsMax) << 4);
+		size += 1;
+	}
+
+	std::unique_ptr<Common::SeekableReadStream>
+		packed(Common::compressDeflate(stream, stream.size(), Common::kWindowBitsMaxRaw));
+
+	size += _file.writeStream(*packed);
+
+	return size;
+}
+
+void ERFUpdater::moveDataBehind(uint32_t offset) {
+	// Make sure data we move lands behind the offset
+	if (_file.size() < offset) {
+		_file.seek(0, Common::SeekableWriteStream::kOriginEnd);
+		_file.writeZeros(offset - _file.size());
+	}
+
+	std::unique_ptr<Common::ReadFile> readFile;
+
+	// Files sharing the same data are moved together
+	std::map<uint32_t, uint32_t> moved;
+
+	for (auto &entry : _entries) {
+		if (entry.offset >= offset)
+			continue;
+
+		std::map<uint32_t, uint32_t>::const_iterator m = moved.find(entry.offset);
+		if (m != moved.end()) {
+			entry.offset = m->second;
+			continue;
+		}
+
+		if (!readFile) {
+			_file.flush();
+			readFile = std::make_unique<Common::ReadFile>(_fileName);
+		}
+
+		std::unique_ptr<Common::SeekableReadStream> data(readFile->readStreamAt(entry.offset, entry.packedSize));
+
+		if (_file.size() > 0xFFFFFFFF)
+			throw Common::Exception("ERF archive grew too big");
+
+		_file.seek(0, Common::SeekableWriteStream::kOriginEnd);
+
+		const uint32_t newOffset = _file.pos();
+		_file.writeStream(*data);
+
+		moved[entry.offset] = newOffset;
+		entry.offset = newOffset;
+	}
+}
+
+void ERFUpdater::flush() {
+	if (!_changed)
+		return;
+
+	const uint32_t count = _entries.size();
+
+	if (count > _tableCapacity) {
+		if (_version == kVersion10) {
+			// The new tables go to the end of the archive
+			_file.seek(0, Common::SeekableWriteStream::kOriginEnd);
+
+			_keyTableOffset      = _file.pos();
+			_resourceTableOffset = _keyTableOffset + count * 24;
+
+			_file.writeZeros(getTablesSize());
+
+		} else
+			moveDataBehind(_resourceTableOffset + getTablesSize());
+
+		_tableCapacity = count;
+	}
+
+	writeTables(_file);
+	_file.flush();
+
+	_changed = false;
+}
+
+void ERFUpdater::writeTables(Common::SeekableWriteStream &stream) const {
+	if (_version == kVersion10) {
+		stream.seek(_keyTableOffset);
+		for (size_t i = 0; i < _entries.size(); i++)
+			ERFWriter::writeV10Key(stream, _entries[i].resRef, _entries[i].resType, i);
+
+		stream.seek(_resourceTableOffset);
+		for (const auto &entry : _entries) {
+			stream.writeUint32LE(entry.offset);
+			stream.writeUint32LE(entry.packedSize);
+		}
+
+	} else {
+		stream.seek(_resourceTableOffset);
+		for (const auto &entry : _entries) {
+			if (_version == kVersion20)
+				ERFWriter::writeV20Entry(stream, entry.fileName, entry.offset, entry.packedSize);
+			else
+				ERFWriter::writeV22Entry(stream, entry.fileName, entry.offset, entry.packedSize, entry.unpackedSize);
+		}
+	}
+
+	// Only now point the header to the new tables
+	stream.seek(kFileCountOffset);
+	stream.writeUint32LE(_entries.size());
+
+	if (_version == kVersion10) {
+		stream.skip(4); // Description offset
+		stream.writeUint32LE(_keyTableOffset);
+		stream.writeUint32LE(_resourceTableOffset);
+	}
+}
+
+void ERFUpdater::compact() {
+	flush();
+
+	const Common::UString tempFileName = _fileName + ".tmp";
+
+	std::vector<Entry> entries = _entries;
+
+	{
+		Common::ReadFile  in(_fileName);
+		Common::WriteFile out(tempFileName);
+
+		// Copy the header and the description, and make room for the tables
+		out.writeStream(in, _headerSize);
+		out.writeZeros(getTablesSize());
+
+		// Copy the data of all files in order, keeping files sharing the same data together
+		std::map<uint32_t, uint32_t> copied;
+
+		for (auto &entry : entries) {
+			std::map<uint32_t, uint32_t>::const_iterator c = copied.find(entry.offset);
+			if (c != copied.end()) {
+				entry.offset = c->second;
+				continue;
+			}
+
+			if (out.size() > 0xFFFFFFFF)
+				throw Common::Exception("ERF archive grew too big");
+
+			const uint32_t newOffset = out.pos();
+
+			std::unique_ptr<Common::SeekableReadStream> data(in.readStreamAt(entry.offset, entry.packedSize));
+			out.writeStream(*data);
+
+			copied[entry.offset] = newOffset;
+			entry.offset = newOffset;
+		}
+
+		_entries.swap(entries);
+
+		if (_version == kVersion10) {
+			_keyTableOffset      = _headerSize;
+			_resourceTableOffset = _headerSize + _entries.size() * 24;
+		}
+
+		_tableCapacity = _entries.size();
+
+		writeTables(out);
+		out.flush();
+	}
+
+	_file.close();
+
+	Common::FilePath::renameFile(tempFileName, _fileName);
+
+	if (!_file.open(_fileName, true))
+		throw Common::Exception("Can't open file \"%s\" for updating", _fileName.c_str());
+}
+
+size_t ERFUpdater::getUnusedSize() const {
+	std::vector<std::pair<uint32_t, uint32_t>> data;
+	data.reserve(_entries.size());
+
+	for (const auto &entry : _entries)
+		data.push_back(std::make_pair(entry.offset, entry.offset + entry.packedSize));
+
+	std::sort(data.begin(), data.end());
+
+	// Count the data of files sharing the same, or overlapping, data only once
+	size_t used = _headerSize + getTablesSize();
+
+	uint32_t end = 0;
+	for (const auto &d : data) {
+		const uint32_t start = MAX(d.first, end);
+		if (d.second > start)
+			used += d.second - start;
+
+		end = MAX(end, d.second);
+	}
+
+	return (_file.size() > used) ? (_file.size() - used) : 0;
+}
+
+} // End of namespace Aurora
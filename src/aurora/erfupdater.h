@@ -0,0 +1,143 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Updating existing BioWare's ERFs (encapsulated resource file) in place.
+ */
+
+#ifndef AURORA_ERFUPDATER_H
+#define AURORA_ERFUPDATER_H
+
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/writefile.h"
+
+#include "src/aurora/types.h"
+#include "src/aurora/erffile.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Aurora {
+
+/** Change single files in an existing ERF archive, without rewriting all of it.
+ *
+ *  New and replaced files are appended to the end of the archive, and
+ *  flush() then only rewrites the key and resource tables. The data of
+ *  replaced and removed files stays in the archive as unused space, until
+ *  the archive is explicitly compacted.
+ *
+ *  Supported are unencrypted ERF archives of the versions ERFWriter can
+ *  write: V1.0, V2.0 and V2.2 (optionally compressed).
+ */
+class ERFUpdater : boost::noncopyable {
+public:
+	/** Open an existing ERF archive for updating. */
+	ERFUpdater(const Common::UString &fileName);
+	/** Write the changed tables. Call flush() first to see any errors. */
+	~ERFUpdater();
+
+	/** Add a file to the archive, replacing a file with the same name and type. */
+	void add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
+
+	/** Remove a file from the archive.
+	 *
+	 *  @return false if the archive doesn't contain such a file.
+	 */
+	bool remove(const Common::UString &resRef, FileType resType);
+
+	/** Write the changed key and resource tables into the archive.
+	 *
+	 *  If the tables grew, a V1.0 archive gets new tables at its end. A V2.x
+	 *  archive always has its resource table right after the header, so the
+	 *  data of files in the way of the grown table is moved to the end.
+	 */
+	void flush();
+
+	/** Rewrite the archive without any unused space.
+	 *
+	 *  The archive is written to a temporary file next to it, which then
+	 *  replaces the original archive.
+	 */
+	void compact();
+
+	/** Return the number of files in the archive. */
+	size_t getFileCount() const;
+
+	/** Return the number of bytes in the archive not used by any file or table. */
+	size_t getUnusedSize() const;
+
+private:
+	/** A file in the archive. */
+	struct Entry {
+		Common::UString resRef; ///< The file's name, without extension.
+		FileType resType;       ///< The file's type.
+
+		/** The full name, as written into a V2.x resource table. */
+		Common::UString fileName;
+
+		uint32_t offset;       ///< The offset of the file's data within the archive.
+		uint32_t packedSize;   ///< The size of the file's data within the archive.
+		uint32_t unpackedSize; ///< The size of the file, once decompressed.
+	};
+
+	Common::UString _fileName;
+	Common::WriteFile _file;
+
+	uint32_t _version { 0 };
+	ERFFile::Compression _compression { ERFFile::kCompressionNone };
+
+	/** Size of the header, including the V1.0 description. */
+	uint32_t _headerSize { 0 };
+
+	uint32_t _keyTableOffset { 0 };
+	uint32_t _resourceTableOffset { 0 };
+	/** The number of files the tables have room for where they are now. */
+	uint32_t _tableCapacity { 0 };
+
+	std::vector<Entry> _entries;
+
+	bool _changed { false };
+
+	void load();
+
+	Entry *findEntry(const Common::UString &resRef, FileType resType);
+
+	uint32_t getResourceTableEntrySize() const;
+	uint32_t getTablesSize() const;
+
+	/** Append a file's data to the archive and return the size written. */
+	uint32_t appendData(Common::SeekableReadStream &stream);
+
+	/** Move the data of all files starting before this offset to the end of the archive. */
+	void moveDataBehind(uint32_t offset);
+
+	/** Write the tables and update the header. */
+	void writeTables(Common::SeekableWriteStream &stream) const;
+};
+
+} // End of namespace Aurora
+
+#endif // AURORA_ERFUPDATER_H
@@ -27,7 +27,9 @@
 #include <memory>
 
 #include "src/common/deflate.h"
+#include "src/common/memreadstream.h"
 #include "src/common/memwritestream.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/erfwriter.h"
 #include "src/aurora/util.h"
@@ -36,9 +38,20 @@ namespace Aurora {
 
 static const uint32_t kVersion10 = MKTAG('V', '1', '.', '0');
 
-ERFWriter::ERFWriter(uint32_t id, uint32_t fileCount, Common::SeekableWriteStream &stream, Version version, Compression compression, LocString description) :
+ERFWriter::ERFWriter(uint32_t id, uint32_t fileCount, Common::SeekableWriteStream &stream, Version version, Compression compression, LocString description,
+                     size_t threadCount, size_t windowSize, bool deduplicate) :
 		_stream(stream), _version(version), _compression(compression), _fileCount(fileCount) {
 
+	if (deduplicate)
+		_deduplicator = std::make_unique<ResourceDeduplicator>();
+
+	// Only compression is expensive enough to be worth doing in parallel
+	if ((threadCount != 1) && (_version == kERFVersion22) && (_compression != kCompressionNone)) {
+		_threadPool = std::make_unique<Common::ThreadPool>(threadCount);
+
+		_windowSize = (windowSize == 0) ? (2 * _threadPool->getThreadCount()) : windowSize;
+	}
+
 	switch (_version) {
 		case kERFVersion10:
 			initV10(id, description);
@@ -57,8 +70,24 @@ ERFWriter::ERFWriter(uint32_t id, uint32_t fileCount, Common::SeekableWriteStrea
 	}
 }
 
+ERFWriter::~ERFWriter() {
+	try {
+		flush();
+	} catch (...) {
+	}
+}
+
+void ERFWriter::flush() {
+	while (!_pending.empty())
+		writePending();
+}
+
+uint64_t ERFWriter::getBytesSaved() const {
+	return _deduplicator ? _deduplicator->getBytesSaved() : 0;
+}
+
 void ERFWriter::add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
-	if (_currentFileCount == _fileCount)
+	if ((_currentFileCount + _pending.size()) == _fileCount)
 		throw Common::Exception("More files added than expected");
 
 	// Files without a type are put into ERF archives as the generic RES type
@@ -70,21 +99,50 @@ void ERFWriter::add(const Common::UString &resRef, FileType resType, Common::See
 	if (resType >= kFileTypeMAXArchive)
 		resType = kFileTypeRES;
 
+	// Files still waiting to be compressed come before this one
+	const uint32_t duplicate = _deduplicator ?
+		_deduplicator->find(stream, _currentFileCount + _pending.size()) : ResourceDeduplicator::kNoDuplicate;
+
 	switch (_version) {
 		case kERFVersion10:
-			addV10(resRef, resType, stream);
+			addV10(resRef, resType, stream, duplicate);
 			break;
 
 		case kERFVersion20:
-			addV20(resRef, resType, stream);
+			addV20(resRef, resType, stream, duplicate);
 			break;
 
 		case kERFVersion22:
-			addV22(resRef, resType, stream);
+			addV22(resRef, resType, stream, duplicate);
 			break;
 	}
 }
 
+ResourceDeduplicator::Location ERFWriter::writeData(Common::SeekableReadStream *data, uint32_t duplicate) {
+	if (duplicate != ResourceDeduplicator::kNoDuplicate)
+		return _deduplicator->reuseLocation(duplicate);
+
+	ResourceDeduplicator::Location location;
+	location.offset = _offsetToResourceData;
+	location.size   = 0;
+
+	_stream.seek(_offsetToResourceData);
+
+	if ((_version == kERFVersion22) && (_compression == kCompressionBiowareZlib)) {
+		_stream.writeByte(static_cast<uint>(Common::kWindowBitsMax) << 4);
+		location.size += 1;
+	}
+
+	location.size += _stream.writeStream(*data);
+
+	if (_deduplicator)
+		_deduplicator->setLocation(_currentFileCount, location.offset, location.size);
+
+	_offsetToResourceData += location.size;
+
+	return location;
+}
+
 void ERFWriter::initV10(uint32_t id, LocString description) {
 	_stream.writeUint32BE(id);
 	_stream.writeUint32BE(kVersion10);
@@ -159,34 +217,23 @@ void ERFWriter::initV20() {
 	_offsetToResourceData = _stream.pos();
 }
 
-void ERFWriter::addV10(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
+void ERFWriter::addV10(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream,
+                       uint32_t duplicate) {
 	// Write the key table entry
 	_stream.seek(_keyTableOffset + _currentFileCount * 24);
 
-	// Write the name
-	{
-		std::unique_ptr<Common::SeekableReadStream> encoded = convertString(resRef, Common::kEncodingASCII, false);
-		const size_t encodedSize = MIN<size_t>(encoded->size(), 16);
-		_stream.writeStream(*encoded, encodedSize);
-		_stream.writeZeros(16 - encodedSize);
-	}
-
-	_stream.writeUint32LE(_currentFileCount);
-	_stream.writeUint16LE(resType);
-	_stream.writeUint16LE(0); // Unused
+	writeV10Key(_stream, resRef, resType, _currentFileCount);
 
 	// Write the actual resource data
-	_stream.seek(_offsetToResourceData);
-	const size_t size = _stream.writeStream(stream);
+	const ResourceDeduplicator::Location location = writeData(&stream, duplicate);
 
 	// Write the resource table entry
 	_stream.seek(_resourceTableOffset + _currentFileCount * 8);
 
-	_stream.writeUint32LE(_offsetToResourceData);
-	_stream.writeUint32LE(size);
+	_stream.writeUint32LE(location.offset);
+	_stream.writeUint32LE(location.size);
 
-	// Advance data offset and file count
-	_offsetToResourceData += size;
+	// Advance file count
 	_currentFileCount += 1;
 }
 
@@ -239,62 +286,121 @@ void ERFWriter::initV22(ERFWriter::Compression compression) {
 	_offsetToResourceData = _stream.pos();
 }
 
-void ERFWriter::addV20(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
+void ERFWriter::addV20(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream,
+                       uint32_t duplicate) {
 	// Write the resource data
-	_stream.seek(_offsetToResourceData);
-	const size_t size = _stream.writeStream(stream);
+	const ResourceDeduplicator::Location location = writeData(&stream, duplicate);
 
 	// Write the resource table entry.
 	_stream.seek(_resourceTableOffset + _currentFileCount * 72);
 
-	Common::writeStringFixed(_stream, TypeMan.addFileType(resRef, resType), Common::kEncodingUTF16LE, 64);
-	_stream.writeUint32LE(_offsetToResourceData);
-	_stream.writeUint32LE(size);
+	writeV20Entry(_stream, TypeMan.addFileType(resRef, resType), location.offset, location.size);
 
-	// Advance offset and file count.
-	_offsetToResourceData += size;
+	// Advance file count.
 	_currentFileCount += 1;
 }
 
-void ERFWriter::addV22(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
-	// Write the resource data
-	_stream.seek(_offsetToResourceData);
+void ERFWriter::addV22(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream,
+                       uint32_t duplicate) {
+	const size_t uncompressedSize = stream.size();
 
-	size_t uncompressedSize = stream.size();
-	size_t size = 0;
+	if (_compression == kCompressionNone) {
+		writeV22(resRef, resType, uncompressedSize, &stream, duplicate);
+		return;
+	}
 
-	switch (_compression) {
-		case kCompressionNone: {
-			size = _stream.writeStream(stream);
-			break;
-		}
-		case kCompressionBiowareZlib: {
-			std::unique_ptr<Common::SeekableReadStream> compressedStream(
-					Common::compressDeflate(stream, uncompressedSize, Common::kWindowBitsMaxRaw));
-			_stream.writeByte(static_cast<uint>(Common::kWindowBitsMax) << 4);
-			size = _stream.writeStream(*compressedStream);
-			size += 1;
-			break;
-		}
-		case kCompressionHeaderlessZlib: {
-			std::unique_ptr<Common::SeekableReadStream> compressedStream(
-					Common::compressDeflate(stream, uncompressedSize, Common::kWindowBitsMaxRaw));
-			size = _stream.writeStream(*compressedStream);
-			break;
-		}
+	if (!_threadPool) {
+		std::unique_ptr<Common::SeekableReadStream> compressedStream;
+		if (duplicate == ResourceDeduplicator::kNoDuplicate)
+			compressedStream.reset(compressV22(stream));
+
+		writeV22(resRef, resType, uncompressedSize, compressedStream.get(), duplicate);
+		return;
 	}
 
+	// Make room in the window, by waiting for the oldest files
+	while (_pending.size() >= _windowSize)
+		writePending();
+
+	PendingFile pending;
+	pending.resRef           = resRef;
+	pending.resType          = resType;
+	pending.uncompressedSize = uncompressedSize;
+	pending.duplicate        = duplicate;
+
+	// Duplicates are never compressed, they point to the data of an earlier file
+	if (duplicate == ResourceDeduplicator::kNoDuplicate) {
+		/* The caller's stream is only valid during this call, so we read it here
+		 * and let one of the pool's threads compress the copy. */
+		std::shared_ptr<Common::SeekableReadStream> data(stream.readStream(uncompressedSize));
+
+		pending.data = _threadPool->addJob([this, data]() {
+			return std::unique_ptr<Common::SeekableReadStream>(compressV22(*data));
+		});
+	}
+
+	_pending.push_back(std::move(pending));
+}
+
+Common::SeekableReadStream *ERFWriter::compressV22(Common::SeekableReadStream &stream) const {
+	return Common::compressDeflate(stream, stream.size(), Common::kWindowBitsMaxRaw);
+}
+
+void ERFWriter::writePending() {
+	PendingFile pending = std::move(_pending.front());
+	_pending.pop_front();
+
+	std::unique_ptr<Common::SeekableReadStream> data;
+	if (pending.data.valid())
+		data = pending.data.get();
+
+	writeV22(pending.resRef, pending.resType, pending.uncompressedSize, data.get(), pending.duplicate);
+}
+
+void ERFWriter::writeV22(const Common::UString &resRef, FileType resType, size_t uncompressedSize,
+                         Common::SeekableReadStream *data, uint32_t duplicate) {
+
+	// Write the resource data
+	const ResourceDeduplicator::Location location = writeData(data, duplicate);
+
 	// Write the resource table entry.
 	_stream.seek(_resourceTableOffset + _currentFileCount * 76);
 
-	Common::writeStringFixed(_stream, TypeMan.addFileType(resRef, resType), Common::kEncodingUTF16LE, 64);
-	_stream.writeUint32LE(_offsetToResourceData);
-	_stream.writeUint32LE(size);
-	_stream.writeUint32LE(uncompressedSize);
+	writeV22Entry(_stream, TypeMan.addFileType(resRef, resType), location.offset, location.size, uncompressedSize);
 
-	// Advance offset and file count.
-	_offsetToResourceData += size;
+	// Advance file count.
 	_currentFileCount += 1;
 }
 
+void ERFWriter::writeV10Key(Common::WriteStream &stream, const Common::UString &resRef,
+                            FileType resType, uint32_t resID) {
+
+	// Write the name
+	{
+		std::unique_ptr<Common::SeekableReadStream> encoded = convertString(resRef, Common::kEncodingASCII, false);
+		const size_t encodedSize = MIN<size_t>(encoded->size(), 16);
+		stream.writeStream(*encoded, encodedSize);
+		stream.writeZeros(16 - encodedSize);
+	}
+
+	stream.writeUint32LE(resID);
+	stream.writeUint16LE(resType);
+	stream.writeUint16LE(0); // Unused
+}
+
+void ERFWriter::writeV20Entry(Common::WriteStream &stream, const Common::UString &name,
+                              uint32_t offset, uint32_t size) {
+
+	Common::writeStringFixed(stream, name, Common::kEncodingUTF16LE, 64);
+	stream.writeUint32LE(offset);
+	stream.writeUint32LE(size);
+}
+
+void ERFWriter::writeV22Entry(Common::WriteStream &stream, const Common::UString &name,
+                              uint32_t offset, uint32_t packedSize, uint32_t unpackedSize) {
+
+	writeV20Entry(stream, name, offset, packedSize);
+	stream.writeUint32LE(unpackedSize);
+}
+
 } // End of namespace Aurora
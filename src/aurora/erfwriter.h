@@ -25,10 +25,19 @@
 #ifndef AURORA_ERFWRITER_H
 #define AURORA_ERFWRITER_H
 
+#include <memory>
+#include <deque>
+#include <future>
+
 #include "src/common/writestream.h"
 #include "src/common/readstream.h"
 
 #include "src/aurora/locstring.h"
+#include "src/aurora/deduplicator.h"
+
+namespace Common {
+	class ThreadPool;
+}
 
 namespace Aurora {
 
@@ -55,23 +64,81 @@ public:
 	 *  @param version The ERF version to write
 	 *  @param compression The compression which has to be applied to every file.
 	 *  @param description The LocString, that should be used for the description.
+	 *  @param threadCount The number of threads compressing files in parallel.
+	 *                     If 0, one thread per hardware thread is used.
+	 *  @param windowSize The maximum number of files to keep in memory while
+	 *                    they wait to be compressed and written. If 0, twice
+	 *                    the number of threads is used.
+	 *  @param deduplicate If true, the data of identical files is only written
+	 *                     once, and all their resource table entries point to it.
 	 */
 	ERFWriter(uint32_t id, uint32_t fileCount, Common::SeekableWriteStream &stream,
 	          Version version = kERFVersion10, Compression compression = kCompressionNone,
-	          LocString description = LocString());
-	~ERFWriter() = default;
+	          LocString description = LocString(), size_t threadCount = 1, size_t windowSize = 0,
+	          bool deduplicate = false);
+	/** Write all remaining files. Call flush() first to see any errors. */
+	~ERFWriter();
 
-	/** Add a new stream to this archive to be packed. */
+	/** Add a new stream to this archive to be packed.
+	 *
+	 *  When compressing a V2.2 ERF with several threads, the file is
+	 *  compressed in the background and only written later. The files
+	 *  are always written in the order they were added, so the archive
+	 *  is the same as the one a single-threaded writer produces.
+	 */
 	void add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
 
+	/** Wait for all files still being compressed and write them. */
+	void flush();
+
+	/** Return the number of bytes not written, because they were duplicates. */
+	uint64_t getBytesSaved() const;
+
+	// .--- Single table entries, also used by ERFUpdater
+	/** Write a V1.0 key table entry. */
+	static void writeV10Key(Common::WriteStream &stream, const Common::UString &resRef,
+	                        FileType resType, uint32_t resID);
+
+	/** Write a V2.0 resource table entry. The name includes the file extension. */
+	static void writeV20Entry(Common::WriteStream &stream, const Common::UString &name,
+	                          uint32_t offset, uint32_t size);
+	/** Write a V2.2 resource table entry. The name includes the file extension. */
+	static void writeV22Entry(Common::WriteStream &stream, const Common::UString &name,
+	                          uint32_t offset, uint32_t packedSize, uint32_t unpackedSize);
+	// '---
+
 private:
+	/** A file waiting to be written, while it is being compressed. */
+	struct PendingFile {
+		Common::UString resRef;
+		FileType resType;
+		size_t uncompressedSize;
+
+		/** The index of an earlier file with the same data, or kNoDuplicate. */
+		uint32_t duplicate;
+
+		std::future<std::unique_ptr<Common::SeekableReadStream>> data;
+	};
+
 	void initV10(uint32_t id, LocString description);
 	void initV20();
 	void initV22(Compression compression);
 
-	void addV10(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
-	void addV20(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
-	void addV22(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
+	void addV10(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream,
+	            uint32_t duplicate);
+	void addV20(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream,
+	            uint32_t duplicate);
+	void addV22(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream,
+	            uint32_t duplicate);
+
+	Common::SeekableReadStream *compressV22(Common::SeekableReadStream &stream) const;
+	void writeV22(const Common::UString &resRef, FileType resType, size_t uncompressedSize,
+	              Common::SeekableReadStream *data, uint32_t duplicate);
+
+	/** Write the data of the current file, or find the data of its duplicate. */
+	ResourceDeduplicator::Location writeData(Common::SeekableReadStream *data, uint32_t duplicate);
+
+	void writePending();
 
 	Common::SeekableWriteStream &_stream;
 
@@ -83,6 +150,12 @@ private:
 	uint32_t _offsetToResourceData { 0 };
 	uint32_t _keyTableOffset { 0 };
 	uint32_t _resourceTableOffset { 0 };
+
+	std::unique_ptr<Common::ThreadPool> _threadPool;
+	std::deque<PendingFile> _pending;
+	size_t _windowSize { 0 };
+
+	std::unique_ptr<ResourceDeduplicator> _deduplicator;
 };
 
 } // End of namespace Aurora
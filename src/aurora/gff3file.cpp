@@ -28,6 +28,8 @@
 
 #include <cassert>
 
+#include <algorithm>
+
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
 #include "src/common/encoding.h"
@@ -43,6 +45,8 @@ static const uint32_t kVersion33 = MKTAG('V', '3', '.', '3'); // Found in The Wi
 
 namespace Aurora {
 
+const uint32_t GFF3File::kLabelIDNone;
+
 GFF3File::Header::Header() {
 }
 
@@ -62,8 +66,8 @@ void GFF3File::Header::read(Common::SeekableReadStream &gff3) {
 }
 
 
-GFF3File::GFF3File(Common::SeekableReadStream *gff3, uint32_t id, bool repairNWNPremium) :
-	_stream(gff3), _repairNWNPremium(repairNWNPremium), _offsetCorrection(0) {
+GFF3File::GFF3File(Common::SeekableReadStream *gff3, uint32_t id, bool repairNWNPremium, bool lazy) :
+	_stream(gff3), _repairNWNPremium(repairNWNPremium), _offsetCorrection(0), _lazy(lazy), _prefetchPass(0) {
 
 	assert(_stream);
 
@@ -87,9 +91,15 @@ void GFF3File::load(uint32_t id) {
 	try {
 
 		loadHeader(id);
+		loadSections();
+		loadLabels();
 		loadStructs();
 		loadLists();
 
+		// Once everything is decoded, the raw structure isn't needed anymore
+		if (!_lazy)
+			freeSections();
+
 	} catch (Common::Exception &e) {
 		e.add("Failed reading GFF3 file");
 		throw;
@@ -169,12 +179,70 @@ void GFF3File::loadHeader(uint32_t id) {
 		throw Common::Exception("GFF3 header broken: section offset points outside stream");
 }
 
+void GFF3File::readSection(Section &section, uint32_t offset, uint32_t count, uint32_t elementSize,
+                           const char *name) {
+
+	const uint64_t size = static_cast<uint64_t>(count) * elementSize;
+	if ((offset + size) > _stream->size())
+		throw Common::Exception("GFF3 header broken: %s section reaches outside stream", name);
+
+	section.resize(static_cast<size_t>(size));
+	if (section.empty())
+		return;
+
+	_stream->seek(offset);
+	_stream->readChecked(section.data(), section.size());
+}
+
+void GFF3File::loadSections() {
+	/* Read all the sections describing the structure of the GFF3 in one go each,
+	 * so that structs and fields can be parsed from memory, without seeking. */
+
+	readSection(_structSection      , _header.structOffset      , _header.structCount      , 12, "struct");
+	readSection(_fieldSection       , _header.fieldOffset       , _header.fieldCount       , 12, "field");
+	readSection(_fieldIndicesSection, _header.fieldIndicesOffset, _header.fieldIndicesCount,  1, "field indices");
+	readSection(_listIndicesSection , _header.listIndicesOffset , _header.listIndicesCount ,  1, "list indices");
+}
+
+void GFF3File::freeSections() {
+	Section().swap(_structSection);
+	Section().swap(_fieldSection);
+	Section().swap(_fieldIndicesSection);
+	Section().swap(_listIndicesSection);
+
+	std::vector<uint32_t>().swap(_labelSectionIDs);
+}
+
+void GFF3File::loadLabels() {
+	static const uint32_t kLabelSize = 16;
+
+	Section labelSection;
+	readSection(labelSection, _header.labelOffset, _header.labelCount, kLabelSize, "label");
+
+	Common::MemoryReadStream labels(labelSection.data(), labelSection.size());
+
+	// Give every distinct label an ID, even if the label section contains duplicates
+	_labelSectionIDs.reserve(_header.labelCount);
+	for (uint32_t i = 0; i < _header.labelCount; i++) {
+		const Common::UString label = Common::readStringFixed(labels, Common::kEncodingASCII, kLabelSize);
+
+		std::pair<LabelMap::iterator, bool> id = _labelIDs.emplace(label, static_cast<uint32_t>(_labels.size()));
+		if (id.second)
+			_labels.push_back(label);
+
+		_labelSectionIDs.push_back(id.first->second);
+	}
+}
+
 void GFF3File::loadStructs() {
-	static const uint32_t kStructSize = 12;
+	_structs.resize(_header.structCount);
+
+	// When loading lazily, structs are only decoded in getStruct()
+	if (_lazy)
+		return;
 
-	_structs.reserve(_header.structCount);
 	for (uint32_t i = 0; i < _header.structCount; i++)
-		_structs.emplace_back(new GFF3Struct(*this, _header.structOffset + i * kStructSize));
+		_structs[i].reset(new GFF3Struct(*this, i));
 }
 
 void GFF3File::loadLists() {
@@ -193,13 +261,11 @@ void GFF3File::loadLists() {
 	 * list of lists into a list index.
 	 */
 
-	_stream->seek(_header.listIndicesOffset);
-
 	// Read list array
 	std::vector<uint32_t> rawLists;
-	rawLists.resize(_header.listIndicesCount / 4);
-	for (std::vector<uint32_t>::iterator it = rawLists.begin(); it != rawLists.end(); ++it)
-		*it = _stream->readUint32LE();
+	rawLists.resize(_listIndicesSection.size() / 4);
+	for (size_t i = 0; i < rawLists.size(); i++)
+		rawLists[i] = READ_LE_UINT32(&_listIndicesSection[i * 4]);
 
 	// Counting the actual amount of lists
 	uint32_t listCount = 0;
@@ -214,6 +280,7 @@ void GFF3File::loadLists() {
 	}
 
 	_lists.resize(listCount);
+	_listLoaded.resize(listCount, false);
 	_listOffsetToIndex.resize(rawLists.size(), 0xFFFFFFFF);
 
 	// Converting the raw list array into real, usable lists
@@ -221,28 +288,65 @@ void GFF3File::loadLists() {
 	for (size_t i = 0; i < rawLists.size(); listIndex++) {
 		_listOffsetToIndex[i] = listIndex;
 
+		const uint32_t offset = i;
+
 		const uint32_t n = rawLists[i++];
 		if ((i + n) > rawLists.size())
 			throw Common::Exception("GFF3: List indices broken during conversion");
 
-		_lists[listIndex].resize(n);
 		for (uint32_t j = 0; j < n; j++, i++) {
 			const size_t structIndex = rawLists[i];
 			if (structIndex >= _structs.size())
 				throw Common::Exception("GFF3: List struct index out of range (%u >= %u)",
 				                        (uint) structIndex, (uint) _structs.size());
-
-			_lists[listIndex][j] = _structs[structIndex].get();
 		}
+
+		// When loading lazily, the struct pointers are only filled in getList()
+		if (!_lazy)
+			loadList(offset, listIndex);
 	}
 }
 
+void GFF3File::loadList(uint32_t offset, uint32_t listIndex) const {
+	// The list has already been validated by loadLists()
+
+	const byte *rawList = &_listIndicesSection[offset * 4];
+
+	const uint32_t n = READ_LE_UINT32(rawList);
+
+	GFF3List &list = _lists[listIndex];
+
+	list.resize(n);
+	for (uint32_t j = 0; j < n; j++)
+		list[j] = &getStruct(READ_LE_UINT32(rawList + (j + 1) * 4));
+
+	_listLoaded[listIndex] = true;
+}
+
+uint32_t GFF3File::getLabelID(const Common::UString &label) const {
+	LabelMap::const_iterator id = _labelIDs.find(label);
+	if (id == _labelIDs.end())
+		return kLabelIDNone;
+
+	return id->second;
+}
+
+const Common::UString &GFF3File::getLabel(uint32_t id) const {
+	if (id >= _labels.size())
+		throw Common::Exception("GFF3: Label ID out of range (%u >= %u)", id, (uint) _labels.size());
+
+	return _labels[id];
+}
+
 // --- Helpers for GFF3Struct ---
 
 const GFF3Struct &GFF3File::getStruct(uint32_t i) const {
 	if (i >= _structs.size())
 		throw Common::Exception("GFF3: Struct index out of range (%u >= %u)", i, (uint) _structs.size());
 
+	if (!_structs[i])
+		_structs[i].reset(new GFF3Struct(*this, i));
+
 	return *_structs[i].get();
 }
 
@@ -258,6 +362,9 @@ const GFF3List &GFF3File::getList(uint32_t i) const {
 
 	assert(listIndex < _lists.size());
 
+	if (!_listLoaded[listIndex])
+		loadList(i, listIndex);
+
 	return _lists[listIndex];
 }
 
@@ -272,26 +379,28 @@ Common::SeekableReadStream &GFF3File::getFieldData() const {
 }
 
 
-GFF3Struct::Field::Field() : type(kFieldTypeNone), data(0), extended(false) {
+GFF3Struct::Field::Field(FieldType t, uint32_t d, uint32_t l, uint32_t p) :
+	type(t), data(d), label(l), position(p) {
+
 }
 
-GFF3Struct::Field::Field(FieldType t, uint32_t d) : type(t), data(d) {
+bool GFF3Struct::Field::isExtended() const {
 	// These field types need extended field data
-	extended = (type == kFieldTypeUint64     ) ||
-	           (type == kFieldTypeSint64     ) ||
-	           (type == kFieldTypeDouble     ) ||
-	           (type == kFieldTypeExoString  ) ||
-	           (type == kFieldTypeResRef     ) ||
-	           (type == kFieldTypeLocString  ) ||
-	           (type == kFieldTypeVoid       ) ||
-	           (type == kFieldTypeOrientation) ||
-	           (type == kFieldTypeVector     ) ||
-	           (type == kFieldTypeStrRef     );
+	return (type == kFieldTypeUint64     ) ||
+	       (type == kFieldTypeSint64     ) ||
+	       (type == kFieldTypeDouble     ) ||
+	       (type == kFieldTypeExoString  ) ||
+	       (type == kFieldTypeResRef     ) ||
+	       (type == kFieldTypeLocString  ) ||
+	       (type == kFieldTypeVoid       ) ||
+	       (type == kFieldTypeOrientation) ||
+	       (type == kFieldTypeVector     ) ||
+	       (type == kFieldTypeStrRef     );
 }
 
 
-GFF3Struct::GFF3Struct(const GFF3File &parent, uint32_t offset) : _parent(&parent) {
-	load(offset);
+GFF3Struct::GFF3Struct(const GFF3File &parent, uint32_t index) : _parent(&parent), _prefetchPass(0) {
+	load(index);
 }
 
 uint32_t GFF3Struct::getID() const {
@@ -300,76 +409,69 @@ uint32_t GFF3Struct::getID() const {
 
 // --- Loader ---
 
-void GFF3Struct::load(uint32_t offset) {
-	Common::SeekableReadStream &data = _parent->getStream(offset);
+void GFF3Struct::load(uint32_t index) {
+	const byte *strct = &_parent->_structSection[index * 12];
+
+	_id = READ_LE_UINT32(strct + 0);
 
-	_id         = data.readUint32LE();
-	_fieldIndex = data.readUint32LE();
-	_fieldCount = data.readUint32LE();
+	const uint32_t fieldIndex = READ_LE_UINT32(strct + 4);
+	const uint32_t fieldCount = READ_LE_UINT32(strct + 8);
 
 	// Read the field(s)
-	if      (_fieldCount == 1)
-		readField (data, _fieldIndex);
-	else if (_fieldCount > 1)
-		readFields(data, _fieldIndex, _fieldCount);
+	if      (fieldCount == 1)
+		readField (fieldIndex);
+	else if (fieldCount > 1)
+		readFields(fieldIndex, fieldCount);
+
+	// Sort the fields by label ID, for a binary search
+	std::stable_sort(_fields.begin(), _fields.end());
+
+	_fieldCount = 0;
+	for (size_t i = 0; i < _fields.size(); i++)
+		if ((i == 0) || (_fields[i].label != _fields[i - 1].label))
+			_fieldCount++;
 }
 
-void GFF3Struct::readField(Common::SeekableReadStream &data, uint32_t index) {
+void GFF3Struct::readField(uint32_t index) {
 	// Sanity check
-	if (index > _parent->_header.fieldCount)
+	if (index >= _parent->_header.fieldCount)
 		throw Common::Exception("GFF3: Field index out of range (%d/%d)",
 				index, _parent->_header.fieldCount);
 
-	// Seek
-	data.seek(_parent->_header.fieldOffset + index * 12);
-
 	// Read the field data
-	const uint32_t fieldType  = data.readUint32LE();
-	const uint32_t fieldLabel = data.readUint32LE();
-	const uint32_t fieldData  = data.readUint32LE();
+	const byte *field = &_parent->_fieldSection[index * 12];
 
-	// Read the name
-	Common::UString fieldName = readLabel(data, fieldLabel);
+	const uint32_t fieldType  = READ_LE_UINT32(field + 0);
+	const uint32_t fieldLabel = READ_LE_UINT32(field + 4);
+	const uint32_t fieldData  = READ_LE_UINT32(field + 8);
 
-	// And add the field to the map and name list
-	_fields[fieldName] = Field((FieldType) fieldType, fieldData);
+	// Look up the label ID
+	if (fieldLabel >= _parent->_labelSectionIDs.size())
+		throw Common::Exception("GFF3: Field label index out of range (%d/%d)",
+		                        fieldLabel, (uint) _parent->_labelSectionIDs.size());
 
-	_fieldNames.push_back(fieldName);
+	const uint32_t labelID = _parent->_labelSectionIDs[fieldLabel];
+
+	_fields.push_back(Field((FieldType) fieldType, fieldData, labelID, static_cast<uint32_t>(_fields.size())));
 }
 
-void GFF3Struct::readFields(Common::SeekableReadStream &data, uint32_t index, uint32_t count) {
+void GFF3Struct::readFields(uint32_t index, uint32_t count) {
 	// Sanity check
-	if (index > _parent->_header.fieldIndicesCount)
-		throw Common::Exception("GFF3: Field indices index out of range (%d/%d)",
-		                        index , _parent->_header.fieldIndicesCount);
-
-	// Seek
-	data.seek(_parent->_header.fieldIndicesOffset + index);
-
-	// Read the field indices
-	std::vector<uint32_t> indices;
-	readIndices(data, indices, count);
+	const size_t indicesSize = _parent->_fieldIndicesSection.size();
+	if ((index > indicesSize) || (count > ((indicesSize - index) / 4)))
+		throw Common::Exception("GFF3: Field indices index out of range (%d+%d/%d)",
+		                        index, count, (uint) indicesSize);
 
 	// Read the fields
-	for (std::vector<uint32_t>::const_iterator i = indices.begin(); i != indices.end(); ++i)
-		readField(data, *i);
-}
+	_fields.reserve(count);
 
-void GFF3Struct::readIndices(Common::SeekableReadStream &data,
-                             std::vector<uint32_t> &indices, uint32_t count) const {
-	indices.reserve(count);
-	while (count-- > 0)
-		indices.push_back(data.readUint32LE());
-}
-
-Common::UString GFF3Struct::readLabel(Common::SeekableReadStream &data, uint32_t index) const {
-	data.seek(_parent->_header.labelOffset + index * 16);
-
-	return Common::readStringFixed(data, Common::kEncodingASCII, 16);
+	const byte *indices = &_parent->_fieldIndicesSection[index];
+	for (uint32_t i = 0; i < count; i++)
+		readField(READ_LE_UINT32(indices + i * 4));
 }
 
 Common::SeekableReadStream &GFF3Struct::getData(const Field &field) const {
-	assert(field.extended);
+	assert(field.isExtended());
 
 	Common::SeekableReadStream &data = _parent->getFieldData();
 	data.skip(field.data);
@@ -380,18 +482,43 @@ Common::SeekableReadStream &GFF3Struct::getData(const Field &field) const {
 // --- Field properties ---
 
 size_t GFF3Struct::getFieldCount() const {
-	return _fields.size();
+	return _fieldCount;
 }
 
 bool GFF3Struct::hasField(const Common::UString &field) const {
+	return hasField(_parent->getLabelID(field));
+}
+
+bool GFF3Struct::hasField(uint32_t field) const {
 	return getField(field) != 0;
 }
 
-const std::vector<Common::UString> &GFF3Struct::getFieldNames() const {
-	return _fieldNames;
+std::vector<Common::UString> GFF3Struct::getFieldNames() const {
+	const std::vector<uint32_t> labels = getFieldLabels();
+
+	std::vector<Common::UString> names;
+	names.reserve(labels.size());
+
+	for (std::vector<uint32_t>::const_iterator l = labels.begin(); l != labels.end(); ++l)
+		names.push_back(_parent->getLabel(*l));
+
+	return names;
+}
+
+std::vector<uint32_t> GFF3Struct::getFieldLabels() const {
+	// Restore the order the fields were found in the file
+	std::vector<uint32_t> labels(_fields.size());
+	for (FieldArray::const_iterator f = _fields.begin(); f != _fields.end(); ++f)
+		labels[f->position] = f->label;
+
+	return labels;
 }
 
 GFF3Struct::FieldType GFF3Struct::getFieldType(const Common::UString &field) const {
+	return getFieldType(_parent->getLabelID(field));
+}
+
+GFF3Struct::FieldType GFF3Struct::getFieldType(uint32_t field) const {
 	const Field *f = getField(field);
 	if (!f)
 		return kFieldTypeNone;
@@ -401,15 +528,88 @@ GFF3Struct::FieldType GFF3Struct::getFieldType(const Common::UString &field) con
 
 // --- Field value reader helpers ---
 
-const GFF3Struct::Field *GFF3Struct::getField(const Common::UString &name) const {
-	FieldMap::const_iterator field = _fields.find(name);
-	if (field == _fields.end())
+const GFF3Struct::Field *GFF3Struct::getField(uint32_t label) const {
+	// Find the last field with this label, which shadows any earlier ones
+	FieldArray::const_iterator field =
+		std::upper_bound(_fields.begin(), _fields.end(), Field(kFieldTypeNone, 0, label));
+
+	if ((field == _fields.begin()) || ((--field)->label != label))
 		return 0;
 
-	return &field->second;
+	return &*field;
 }
 
+// --- Field value readers, by name ---
+
 char GFF3Struct::getChar(const Common::UString &field, char def) const {
+	return getChar(_parent->getLabelID(field), def);
+}
+
+uint64_t GFF3Struct::getUint(const Common::UString &field, uint64_t def) const {
+	return getUint(_parent->getLabelID(field), def);
+}
+
+int64_t GFF3Struct::getSint(const Common::UString &field, int64_t def) const {
+	return getSint(_parent->getLabelID(field), def);
+}
+
+bool GFF3Struct::getBool(const Common::UString &field, bool def) const {
+	return getBool(_parent->getLabelID(field), def);
+}
+
+double GFF3Struct::getDouble(const Common::UString &field, double def) const {
+	return getDouble(_parent->getLabelID(field), def);
+}
+
+Common::UString GFF3Struct::getString(const Common::UString &field,
+                                      const Common::UString &def) const {
+
+	return getString(_parent->getLabelID(field), def);
+}
+
+bool GFF3Struct::getLocString(const Common::UString &field, LocString &str) const {
+	return getLocString(_parent->getLabelID(field), str);
+}
+
+Common::SeekableReadStream *GFF3Struct::getData(const Common::UString &field) const {
+	return getData(_parent->getLabelID(field));
+}
+
+void GFF3Struct::getVector(const Common::UString &field,
+                           float &x, float &y, float &z) const {
+
+	getVector(_parent->getLabelID(field), x, y, z);
+}
+
+void GFF3Struct::getOrientation(const Common::UString &field,
+                                float &a, float &b, float &c, float &d) const {
+
+	getOrientation(_parent->getLabelID(field), a, b, c, d);
+}
+
+void GFF3Struct::getVector(const Common::UString &field,
+                           double &x, double &y, double &z) const {
+
+	getVector(_parent->getLabelID(field), x, y, z);
+}
+
+void GFF3Struct::getOrientation(const Common::UString &field,
+                                double &a, double &b, double &c, double &d) const {
+
+	getOrientation(_parent->getLabelID(field), a, b, c, d);
+}
+
+const GFF3Struct &GFF3Struct::getStruct(const Common::UString &field) const {
+	return getStruct(_parent->getLabelID(field));
+}
+
+const GFF3List &GFF3Struct::getList(const Common::UString &field) const {
+	return getList(_parent->getLabelID(field));
+}
+
+// --- Field value readers, by label ID ---
+
+char GFF3Struct::getChar(uint32_t field, char def) const {
 	const Field *f = getField(field);
 	if (!f)
 		return def;
@@ -419,7 +619,7 @@ char GFF3Struct::getChar(const Common::UString &field, char def) const {
 	return (char) f->data;
 }
 
-uint64_t GFF3Struct::getUint(const Common::UString &field, uint64_t def) const {
+uint64_t GFF3Struct::getUint(uint32_t field, uint64_t def) const {
 	const Field *f = getField(field);
 	if (!f)
 		return def;
@@ -456,7 +656,7 @@ uint64_t GFF3Struct::getUint(const Common::UString &field, uint64_t def) const {
 	throw Common::Exception("GFF3: Field is not an int type");
 }
 
-int64_t GFF3Struct::getSint(const Common::UString &field, int64_t def) const {
+int64_t GFF3Struct::getSint(uint32_t field, int64_t def) const {
 	const Field *f = getField(field);
 	if (!f)
 		return def;
@@ -493,11 +693,11 @@ int64_t GFF3Struct::getSint(const Common::UString &field, int64_t def) const {
 	throw Common::Exception("GFF3: Field is not an int type");
 }
 
-bool GFF3Struct::getBool(const Common::UString &field, bool def) const {
+bool GFF3Struct::getBool(uint32_t field, bool def) const {
 	return getUint(field, def) != 0;
 }
 
-double GFF3Struct::getDouble(const Common::UString &field, double def) const {
+double GFF3Struct::getDouble(uint32_t field, double def) const {
 	const Field *f = getField(field);
 	if (!f)
 		return def;
@@ -510,7 +710,7 @@ double GFF3Struct::getDouble(const Common::UString &field, double def) const {
 	throw Common::Exception("GFF3: Field is not a double type");
 }
 
-Common::UString GFF3Struct::getString(const Common::UString &field,
+Common::UString GFF3Struct::getString(uint32_t field,
                                       const Common::UString &def) const {
 
 	const Field *f = getField(field);
@@ -597,7 +797,7 @@ Common::UString GFF3Struct::getString(const Common::UString &field,
 	throw Common::Exception("GFF3: Field is not a string(able) type");
 }
 
-bool GFF3Struct::getLocString(const Common::UString &field, LocString &str) const {
+bool GFF3Struct::getLocString(uint32_t field, LocString &str) const {
 	const Field *f = getField(field);
 	if (!f || (f->type != kFieldTypeLocString))
 		return false;
@@ -621,7 +821,7 @@ bool GFF3Struct::getLocString(const Common::UString &field, LocString &str) cons
 	return true;
 }
 
-Common::SeekableReadStream *GFF3Struct::getData(const Common::UString &field) const {
+Common::SeekableReadStream *GFF3Struct::getData(uint32_t field) const {
 	const Field *f = getField(field);
 	if (!f)
 		return 0;
@@ -643,7 +843,7 @@ Common::SeekableReadStream *GFF3Struct::getData(const Common::UString &field) co
 	return data.readStream(size);
 }
 
-void GFF3Struct::getVector(const Common::UString &field,
+void GFF3Struct::getVector(uint32_t field,
                            float &x, float &y, float &z) const {
 
 	const Field *f = getField(field);
@@ -659,7 +859,7 @@ void GFF3Struct::getVector(const Common::UString &field,
 	z = data.readIEEEFloatLE();
 }
 
-void GFF3Struct::getOrientation(const Common::UString &field,
+void GFF3Struct::getOrientation(uint32_t field,
                                 float &a, float &b, float &c, float &d) const {
 
 	const Field *f = getField(field);
@@ -676,7 +876,7 @@ void GFF3Struct::getOrientation(const Common::UString &field,
 	d = data.readIEEEFloatLE();
 }
 
-void GFF3Struct::getVector(const Common::UString &field,
+void GFF3Struct::getVector(uint32_t field,
                            double &x, double &y, double &z) const {
 
 	const Field *f = getField(field);
@@ -692,7 +892,7 @@ void GFF3Struct::getVector(const Common::UString &field,
 	z = data.readIEEEFloatLE();
 }
 
-void GFF3Struct::getOrientation(const Common::UString &field,
+void GFF3Struct::getOrientation(uint32_t field,
                                 double &a, double &b, double &c, double &d) const {
 
 	const Field *f = getField(field);
@@ -711,7 +911,7 @@ void GFF3Struct::getOrientation(const Common::UString &field,
 
 // --- Struct reader ---
 
-const GFF3Struct &GFF3Struct::getStruct(const Common::UString &field) const {
+const GFF3Struct &GFF3Struct::getStruct(uint32_t field) const {
 	const Field *f = getField(field);
 	if (!f)
 		throw Common::Exception("GFF3: No such field");
@@ -724,7 +924,7 @@ const GFF3Struct &GFF3Struct::getStruct(const Common::UString &field) const {
 
 // --- Struct list reader ---
 
-const GFF3List &GFF3Struct::getList(const Common::UString &field) const {
+const GFF3List &GFF3Struct::getList(uint32_t field) const {
 	const Field *f = getField(field);
 	if (!f)
 		throw Common::Exception("GFF3: No such field");
@@ -735,4 +935,46 @@ const GFF3List &GFF3Struct::getList(const Common::UString &field) const {
 	return _parent->getList(f->data / 4);
 }
 
+// --- Prefetching ---
+
+void GFF3Struct::prefetch() const {
+	if (!_parent->_lazy)
+		return;
+
+	/* Walk through the branch below this struct without recursion, since
+	 * GFF3s can be nested deeply. A struct can be found in several lists,
+	 * so we mark each struct we visit with the number of this prefetch pass. */
+
+	const uint32_t pass = ++_parent->_prefetchPass;
+
+	std::vector<const GFF3Struct *> pending(1, this);
+	_prefetchPass = pass;
+
+	while (!pending.empty()) {
+		const GFF3Struct &strct = *pending.back();
+		pending.pop_back();
+
+		for (FieldArray::const_iterator f = strct._fields.begin(); f != strct._fields.end(); ++f) {
+			if (f->type == kFieldTypeStruct) {
+				const GFF3Struct &child = _parent->getStruct(f->data);
+
+				if (child._prefetchPass != pass) {
+					child._prefetchPass = pass;
+					pending.push_back(&child);
+				}
+
+			} else if (f->type == kFieldTypeList) {
+				const GFF3List &list = _parent->getList(f->data / 4);
+
+				for (GFF3List::const_iterator child = list.begin(); child != list.end(); ++child) {
+					if ((*child)->_prefetchPass != pass) {
+						(*child)->_prefetchPass = pass;
+						pending.push_back(*child);
+					}
+				}
+			}
+		}
+	}
+}
+
 } // End of namespace Aurora
@@ -26,10 +26,10 @@
 #define AURORA_GFF3FILE_H
 
 #include <vector>
-#include <map>
 #include <memory>
 
 #include <boost/noncopyable.hpp>
+#include <boost/unordered/unordered_map.hpp>
 
 #include "src/common/types.h"
 #include "src/common/ustring.h"
@@ -72,6 +72,15 @@ class GFF3Struct;
  *  parameter is set to false, no detection will take place, and these
  *  broken files will lead the loader to throw an exception.
  *
+ *  By default, all structs of the GFF3 are decoded when the file is loaded.
+ *  When the constructor parameter lazy is set to true, only the header and
+ *  the raw struct and field definitions are read, and each struct is decoded
+ *  when it is first reached through getTopLevel(), getStruct() or getList().
+ *  This is useful when only a few fields of a large GFF3 are needed. Note
+ *  that errors in the definition of a struct will then also only be found,
+ *  and an exception thrown, when that struct is first reached. To decode
+ *  a whole branch of a lazy GFF3 in one go, see GFF3Struct::prefetch().
+ *
  *  There is no functional difference between GFF V3.2 and V3.3 files. GFF
  *  V3.3 files exclusively appear in The Witcher (and every GFF file there
  *  is of version V3.3), simply to denote that the language table used for
@@ -84,7 +93,8 @@ class GFF3Struct;
 class GFF3File : boost::noncopyable, public AuroraFile {
 public:
 	/** Take over this stream and read a GFF3 file out of it. */
-	GFF3File(Common::SeekableReadStream *gff3, uint32_t id = 0xFFFFFFFF, bool repairNWNPremium = false);
+	GFF3File(Common::SeekableReadStream *gff3, uint32_t id = 0xFFFFFFFF, bool repairNWNPremium = false,
+	         bool lazy = false);
 	virtual ~GFF3File();
 
 	/** Return the GFF3's specific type. */
@@ -93,6 +103,18 @@ public:
 	/** Returns the top-level struct. */
 	const GFF3Struct &getTopLevel() const;
 
+	/** The label ID of a label that doesn't exist in this GFF3. */
+	static const uint32_t kLabelIDNone = 0xFFFFFFFF;
+
+	/** Return the ID of this field label, or kLabelIDNone if no field in this GFF3 has this label.
+	 *
+	 *  Each distinct label in the GFF3 has its own ID. Looking up a field by its
+	 *  label ID, instead of by its name, skips hashing the name for every struct.
+	 *  This is useful when reading the same field out of many structs.
+	 */
+	uint32_t getLabelID(const Common::UString &label) const;
+	/** Return the field label with this ID. */
+	const Common::UString &getLabel(uint32_t id) const;
 
 private:
 	/** A GFF3 header. */
@@ -118,6 +140,11 @@ private:
 	typedef std::vector<std::unique_ptr<GFF3Struct>> StructArray;
 	typedef std::vector<GFF3List> ListArray;
 
+	typedef boost::unordered_map<Common::UString, uint32_t, Common::hashUStringCaseSensitive> LabelMap;
+
+	/** A section of the GFF3, read into memory in one go. */
+	typedef std::vector<byte> Section;
+
 
 	std::unique_ptr<Common::SeekableReadStream> _stream;
 
@@ -128,8 +155,30 @@ private:
 	/** The correctional value for offsets to repair Neverwinter Nights premium modules. */
 	uint32_t _offsetCorrection;
 
-	StructArray _structs; ///< Our structs.
-	ListArray   _lists;   ///< Our lists.
+	/** Only decode structs when they're first reached? */
+	bool _lazy;
+
+	mutable StructArray _structs; ///< Our structs, or nullptr for not yet decoded ones.
+	mutable ListArray   _lists;   ///< Our lists.
+
+	/** Have the struct pointers of this list already been filled in? */
+	mutable std::vector<bool> _listLoaded;
+
+	/** The number of the last GFF3Struct::prefetch() pass. */
+	mutable uint32_t _prefetchPass;
+
+	/* The raw sections are only kept around after loading when loading lazily. */
+	Section _structSection;       ///< The raw struct definitions.
+	Section _fieldSection;        ///< The raw field definitions.
+	Section _fieldIndicesSection; ///< The raw field indices of structs with several fields.
+	Section _listIndicesSection;  ///< The raw list indices.
+
+	/** All distinct field labels, indexed by their label ID. */
+	std::vector<Common::UString> _labels;
+	/** The label IDs of the distinct field labels. */
+	LabelMap _labelIDs;
+	/** The label ID of each entry in the GFF3's label section. */
+	std::vector<uint32_t> _labelSectionIDs;
 
 	/** To convert list offsets found in GFF3 to real indices. */
 	std::vector<uint32_t> _listOffsetToIndex;
@@ -138,8 +187,19 @@ private:
 	// .--- Loading helpers
 	void load(uint32_t id);
 	void loadHeader(uint32_t id);
+	void loadSections();
+	/** Free the raw sections, once all structs and lists are decoded. */
+	void freeSections();
+	void loadLabels();
 	void loadStructs();
 	void loadLists();
+
+	/** Fill in the struct pointers of the list at this offset. */
+	void loadList(uint32_t offset, uint32_t listIndex) const;
+
+	/** Read a whole section of count elements with a size of elementSize bytes each. */
+	void readSection(Section &section, uint32_t offset, uint32_t count, uint32_t elementSize,
+	                 const char *name);
 	// '---
 
 	// .--- Helper methods called by GFF3Struct
@@ -199,12 +259,18 @@ public:
 	size_t getFieldCount() const;
 	/** Does this specific field exist? */
 	bool hasField(const Common::UString &field) const;
+	/** Does this specific field exist? */
+	bool hasField(uint32_t field) const;
 
 	/** Return a list of all field names in this struct. */
-	const std::vector<Common::UString> &getFieldNames() const;
+	std::vector<Common::UString> getFieldNames() const;
+	/** Return a list of the label IDs of all fields in this struct. */
+	std::vector<uint32_t> getFieldLabels() const;
 
 	/** Return the type of this field, or kFieldTypeNone if such a field doesn't exist. */
 	FieldType getFieldType(const Common::UString &field) const;
+	/** Return the type of this field, or kFieldTypeNone if such a field doesn't exist. */
+	FieldType getFieldType(uint32_t field) const;
 
 
 	// .--- Read field values
@@ -233,53 +299,91 @@ public:
 	Common::SeekableReadStream *getData(const Common::UString &field) const;
 	// '---
 
+	// .--- Read field values, by label ID (see GFF3File::getLabelID())
+	char   getChar(uint32_t field, char   def = '\0' ) const;
+	uint64_t getUint(uint32_t field, uint64_t def = 0    ) const;
+	 int64_t getSint(uint32_t field,  int64_t def = 0    ) const;
+	bool   getBool(uint32_t field, bool   def = false) const;
+
+	double getDouble(uint32_t field, double def = 0.0) const;
+
+	Common::UString getString(uint32_t field, const Common::UString &def = "") const;
+
+	bool getLocString(uint32_t field, LocString &str) const;
+
+	void getVector     (uint32_t field, float &x, float &y, float &z          ) const;
+	void getOrientation(uint32_t field, float &a, float &b, float &c, float &d) const;
+
+	void getVector     (uint32_t field, double &x, double &y, double &z           ) const;
+	void getOrientation(uint32_t field, double &a, double &b, double &c, double &d) const;
+
+	Common::SeekableReadStream *getData(uint32_t field) const;
+	// '---
+
 	// .--- Structs and lists of structs
 	const GFF3Struct &getStruct(const Common::UString &field) const;
 	const GFF3List   &getList  (const Common::UString &field) const;
+
+	const GFF3Struct &getStruct(uint32_t field) const;
+	const GFF3List   &getList  (uint32_t field) const;
 	// '---
 
+	/** Decode all structs reachable from this struct.
+	 *
+	 *  In a GFF3 that was loaded lazily, this decodes the whole branch below
+	 *  this struct in one go, instead of each struct on first access. In a
+	 *  GFF3 that was loaded normally, all structs are already decoded and
+	 *  this does nothing.
+	 */
+	void prefetch() const;
+
 private:
 	/** A field in the GFF3 struct. */
 	struct Field {
 		FieldType type;     ///< Type of the field.
 		uint32_t  data;     ///< Data of the field.
-		bool      extended; ///< Does this field need extended data?
+		uint32_t  label;    ///< The label ID of the field.
+		uint32_t  position; ///< The position of the field within the struct in the file.
+
+		Field(FieldType t = kFieldTypeNone, uint32_t d = 0, uint32_t l = 0, uint32_t p = 0);
 
-		Field();
-		Field(FieldType t, uint32_t d);
+		/** Does this field need extended data? */
+		bool isExtended() const;
+
+		bool operator<(const Field &rhs) const { return label < rhs.label; }
 	};
 
-	typedef std::map<Common::UString, Field> FieldMap;
+	typedef std::vector<Field> FieldArray;
 
 
 	const GFF3File *_parent; ///< The parent GFF3.
 
 	uint32_t _id;         ///< The struct's ID.
-	uint32_t _fieldIndex; ///< Field / Field indices index.
-	uint32_t _fieldCount; ///< Field count.
+	uint32_t _fieldCount; ///< Number of distinct fields.
 
-	FieldMap _fields; ///< The fields, indexed by their label.
+	/** The fields, sorted by their label ID.
+	 *
+	 *  Fields with the same label stay in the order found in the file,
+	 *  with the last one shadowing the ones before.
+	 */
+	FieldArray _fields;
 
-	/** The names of all fields in this struct. */
-	std::vector<Common::UString> _fieldNames;
+	/** The number of the last prefetch() pass that visited this struct. */
+	mutable uint32_t _prefetchPass;
 
 
 	// .--- Loader
-	GFF3Struct(const GFF3File &parent, uint32_t offset);
-
-	void load(uint32_t offset);
+	GFF3Struct(const GFF3File &parent, uint32_t index);
 
-	void readField  (Common::SeekableReadStream &data, uint32_t index);
-	void readFields (Common::SeekableReadStream &data, uint32_t index, uint32_t count);
-	void readIndices(Common::SeekableReadStream &data,
-	                 std::vector<uint32_t> &indices, uint32_t count) const;
+	void load(uint32_t index);
 
-	Common::UString readLabel(Common::SeekableReadStream &data, uint32_t index) const;
+	void readField (uint32_t index);
+	void readFields(uint32_t index, uint32_t count);
 	// '---
 
 	// .--- Field and field data accessors
-	/** Returns the field with this tag. */
-	const Field *getField(const Common::UString &name) const;
+	/** Returns the field with this label ID. */
+	const Field *getField(uint32_t label) const;
 	/** Returns the extended field data for this field. */
 	Common::SeekableReadStream &getData(const Field &field) const;
 	// '---
@@ -24,8 +24,6 @@
 
 #include <cstring>
 
-#include <algorithm>
-
 #include <boost/make_shared.hpp>
 
 #include "src/common/writestream.h"
@@ -53,6 +51,60 @@ GFF3Writer::VoidData &GFF3Writer::VoidData::operator=(const VoidData &rhs) {
 }
 
 
+/** Hash a floating point number, with 0.0 and -0.0 hashing equal, since they compare equal. */
+template<typename T> static size_t hashFloat(T v) {
+	return boost::hash<T>()((v == 0) ? 0 : v);
+}
+
+size_t GFF3Writer::ValueDataHash::operator()(float v) const {
+	return hashFloat(v);
+}
+
+size_t GFF3Writer::ValueDataHash::operator()(double v) const {
+	return hashFloat(v);
+}
+
+size_t GFF3Writer::ValueDataHash::operator()(const Vector4 &v) const {
+	size_t seed = 0;
+
+	boost::hash_combine(seed, hashFloat(v.x));
+	boost::hash_combine(seed, hashFloat(v.y));
+	boost::hash_combine(seed, hashFloat(v.z));
+	boost::hash_combine(seed, hashFloat(v.w));
+
+	return seed;
+}
+
+size_t GFF3Writer::ValueDataHash::operator()(const Common::UString &v) const {
+	return Common::hashUStringCaseSensitive()(v);
+}
+
+size_t GFF3Writer::ValueDataHash::operator()(const LocString &v) const {
+	size_t seed = 0;
+
+	boost::hash_combine(seed, v.getID());
+	boost::hash_combine(seed, v.getNumStrings());
+	boost::hash_combine(seed, Common::hashUStringCaseSensitive()(v.getFirstString()));
+
+	return seed;
+}
+
+size_t GFF3Writer::ValueDataHash::operator()(const VoidData &v) const {
+	// Void data only ever compares equal to itself
+	return boost::hash<const Common::SeekableReadStream *>()(v.data.get());
+}
+
+size_t GFF3Writer::hashValue::operator()(const Value *value) const {
+	size_t seed = 0;
+
+	boost::hash_combine(seed, static_cast<uint32_t>(value->type));
+	boost::hash_combine(seed, value->data.which());
+	boost::hash_combine(seed, boost::apply_visitor(ValueDataHash(), value->data));
+
+	return seed;
+}
+
+
 GFF3Writer::GFF3Writer(uint32_t id, uint32_t version) : _id(id), _version(version) {
 	_structs.push_back(boost::make_shared<GFF3WriterStruct>(this));
 }
@@ -62,11 +114,26 @@ GFF3WriterStructPtr GFF3Writer::getTopLevel() {
 }
 
 void GFF3Writer::write(Common::WriteStream &stream) {
-	// Extract all individual values of the fields.
-	std::list<Value> individualValues;
-	for (const auto &field : _fields) {
-		if (std::find(individualValues.begin(), individualValues.end(), field->value) == individualValues.end())
-			individualValues.push_back(field->value);
+	/* Extract all individual values of the complex fields, in the order they first appear,
+	 * and place each into the field data section. Equal values share the same field data. */
+	std::vector<const Value *> individualValues;
+	std::vector<uint32_t> fieldDataOffsets(_fields.size(), 0);
+
+	uint32_t fieldDataCount = 0;
+
+	ValueOffsetMap valueOffsets;
+	for (size_t i = 0; i < _fields.size(); ++i) {
+		const Value &value = _fields[i]->value;
+		if (isSimpleFieldType(value.type))
+			continue;
+
+		std::pair<ValueOffsetMap::iterator, bool> offset = valueOffsets.emplace(&value, fieldDataCount);
+		if (offset.second) {
+			individualValues.push_back(&value);
+			fieldDataCount += getFieldDataSize(value);
+		}
+
+		fieldDataOffsets[i] = offset.first->second;
 	}
 
 	stream.writeUint32BE(_id);
@@ -82,12 +149,6 @@ void GFF3Writer::write(Common::WriteStream &stream) {
 	uint32_t labelCount = static_cast<uint32_t>(_labels.size());
 
 	uint32_t fieldDataOffset = labelOffset + labelCount * 16;
-	uint32_t fieldDataCount = 0;
-
-	// Count the total size of field data
-	for (const auto &value : individualValues) {
-		fieldDataCount += getFieldDataSize(value);
-	}
 
 	uint32_t fieldIndicesOffset = fieldDataOffset + fieldDataCount;
 	uint32_t fieldIndicesCount = 0;
@@ -147,31 +208,14 @@ void GFF3Writer::write(Common::WriteStream &stream) {
 	}
 
 	// Write fields
-	size_t fieldDataIndex = 0;
 	size_t listDataIndex = 0;
 
-	// Maps for checking for already existing values
-	std::map<Value, size_t> valueIndices;
-
 	for (size_t i = 0; i < _fields.size(); ++i) {
-		FieldPtr field = _fields[i];
+		const FieldPtr &field = _fields[i];
 		stream.writeUint32LE(field->value.type);
 		stream.writeUint32LE(field->labelIndex);
 
-		/* Determine if this field has simple values (less equal 32 bit) which are written in the field
-		 * or complex values, bigger than 32bit like strings written in the field data section. */
-		const bool simple =
-			field->value.type == GFF3Struct::kFieldTypeByte ||
-			field->value.type == GFF3Struct::kFieldTypeChar ||
-			field->value.type == GFF3Struct::kFieldTypeUint16 ||
-			field->value.type == GFF3Struct::kFieldTypeUint32 ||
-			field->value.type == GFF3Struct::kFieldTypeStruct ||
-			field->value.type == GFF3Struct::kFieldTypeSint16 ||
-			field->value.type == GFF3Struct::kFieldTypeSint32 ||
-			field->value.type == GFF3Struct::kFieldTypeFloat ||
-			field->value.type == GFF3Struct::kFieldTypeList;
-
-		if (simple) {
+		if (isSimpleFieldType(field->value.type)) {
 			// If the values are simple (less equal 4 bytes) write them to the field
 			switch (field->value.type) {
 				case GFF3Struct::kFieldTypeByte:
@@ -197,17 +241,7 @@ void GFF3Writer::write(Common::WriteStream &stream) {
 			}
 		} else {
 			// If the values are complex (greater then 4 bytes) write the index to the field data
-
-			size_t index = 0;
-			if (valueIndices.find(field->value) == valueIndices.end()) {
-				index = fieldDataIndex;
-				fieldDataIndex += getFieldDataSize(field->value);
-				valueIndices[field->value] = index;
-			} else {
-				index = valueIndices[field->value];
-			}
-
-			stream.writeUint32LE(index);
+			stream.writeUint32LE(fieldDataOffsets[i]);
 		}
 	}
 
@@ -219,7 +253,9 @@ void GFF3Writer::write(Common::WriteStream &stream) {
 	}
 
 	// Write field data
-	for (const auto &value : individualValues) {
+	for (const auto &individualValue : individualValues) {
+		const Value &value = *individualValue;
+
 		switch (value.type) {
 			case GFF3Struct::kFieldTypeUint64:
 				stream.writeUint64LE(boost::get<uint64_t>(value.data));
@@ -314,16 +350,30 @@ void GFF3Writer::write(Common::WriteStream &stream) {
 }
 
 uint32_t GFF3Writer::addLabel(const Common::UString &label) {
-	std::vector<Common::UString>::iterator iter = std::find(_labels.begin(), _labels.end(), label);
-	if (iter != _labels.end()) {
-		return static_cast<uint32_t>(std::distance(_labels.begin(), iter));
-	} else {
+	std::pair<LabelIndexMap::iterator, bool> index =
+		_labelIndices.emplace(label, static_cast<uint32_t>(_labels.size()));
+
+	if (index.second)
 		_labels.push_back(label);
-		return static_cast<uint32_t>(_labels.size() - 1);
-	}
+
+	return index.first->second;
+}
+
+bool GFF3Writer::isSimpleFieldType(GFF3Struct::FieldType type) {
+	/* Simple values (less equal 32 bit) are written in the field, while complex
+	 * values bigger than 32bit, like strings, are written in the field data section. */
+	return type == GFF3Struct::kFieldTypeByte ||
+	       type == GFF3Struct::kFieldTypeChar ||
+	       type == GFF3Struct::kFieldTypeUint16 ||
+	       type == GFF3Struct::kFieldTypeUint32 ||
+	       type == GFF3Struct::kFieldTypeStruct ||
+	       type == GFF3Struct::kFieldTypeSint16 ||
+	       type == GFF3Struct::kFieldTypeSint32 ||
+	       type == GFF3Struct::kFieldTypeFloat ||
+	       type == GFF3Struct::kFieldTypeList;
 }
 
-uint32_t GFF3Writer::getFieldDataSize(Value value) {
+uint32_t GFF3Writer::getFieldDataSize(const Value &value) {
 	switch (value.type) {
 		case GFF3Struct::kFieldTypeUint64:
 		case GFF3Struct::kFieldTypeSint64:
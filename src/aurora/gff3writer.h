@@ -25,12 +25,14 @@
 #ifndef AURORA_GFF3WRITER_H
 #define AURORA_GFF3WRITER_H
 
-#include <list>
+#include <vector>
 #include <functional>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/variant.hpp>
+#include <boost/unordered/unordered_map.hpp>
+#include <boost/functional/hash.hpp>
 
 #include "src/common/readstream.h"
 #include "src/common/memwritestream.h"
@@ -67,30 +69,6 @@ private:
 		bool operator==(const Vector4 &v)  const {
 			return x == v.x && y == v.y && z == v.z && w == v.w;
 		}
-
-		bool operator<(const Vector4 &v) const {
-			if (x < v.x)
-				return true;
-			if (x > v.x)
-				return false;
-
-			if (y < v.y)
-				return true;
-			if (y > v.y)
-				return false;
-
-			if (z < v.z)
-				return true;
-			if (z > v.z)
-				return false;
-
-			if (w < v.w)
-				return true;
-			if (w > v.w)
-				return false;
-
-			return false;
-		}
 	};
 
 	/** A special struct type for representing void data. */
@@ -108,10 +86,6 @@ private:
 		bool operator==(const VoidData &rhs) const {
 			return data.get() == rhs.data.get();
 		}
-
-		bool operator<(const VoidData &rhs) const {
-			return std::less<Common::SeekableReadStream*>{}(data.get(), rhs.data.get());
-		}
 	};
 
 	/** A variant containing all possible types of GFF data. */
@@ -128,11 +102,17 @@ private:
 		VoidData
 	> ValueData;
 
-	class ValueDataLess : public boost::static_visitor<bool> {
+	/** Hash the data of a value. Values that compare equal need to hash equal. */
+	class ValueDataHash : public boost::static_visitor<size_t> {
 	public:
-		template<typename T, typename U> bool operator()(const T &UNUSED(v1), const U &UNUSED(v2)) const { return false; }
-
-		template<typename T> bool operator()(const T &v1, const T &v2) const { return v1 < v2; }
+		template<typename T> size_t operator()(const T &v) const { return boost::hash<T>()(v); }
+
+		size_t operator()(float v) const;
+		size_t operator()(double v) const;
+		size_t operator()(const Vector4 &v) const;
+		size_t operator()(const Common::UString &v) const;
+		size_t operator()(const LocString &v) const;
+		size_t operator()(const VoidData &v) const;
 	};
 
 	/** A value holds a type and data. */
@@ -141,24 +121,30 @@ private:
 		ValueData data;
 		bool isRaw { false };
 
-		/** Equality operator for std::find. */
+		/** Equality operator for finding an already written value. */
 		bool operator==(const Value &rhs) const {
 			return type == rhs.type &&
 			       data == rhs.data;
 		}
+	};
+
+	/** Hash a value, consistent with Value::operator==. */
+	struct hashValue {
+		size_t operator()(const Value *value) const;
+	};
 
-		/** Relational operator for map find. */
-		bool operator<(const Value &rhs) const {
-			if (type != rhs.type) {
-				return type < rhs.type;
-			} else if (data.which() != rhs.data.which()) {
-				return data.which() < rhs.data.which();
-			} else {
-				return boost::apply_visitor(ValueDataLess(), data, rhs.data);
-			}
+	/** Compare two values by their contents, not by their addresses. */
+	struct equalValue {
+		bool operator()(const Value *value1, const Value *value2) const {
+			return *value1 == *value2;
 		}
 	};
 
+	/** Offsets of the individual values already placed into the field data section. */
+	typedef boost::unordered_map<const Value *, uint32_t, hashValue, equalValue> ValueOffsetMap;
+
+	typedef boost::unordered_map<Common::UString, uint32_t, Common::hashUStringCaseSensitive> LabelIndexMap;
+
 	/** An implementation for a field. */
 	struct Field : boost::noncopyable {
 		uint32_t labelIndex;
@@ -176,13 +162,18 @@ private:
 	std::vector<Common::UString> _labels;
 	std::vector<FieldPtr> _fields;
 
+	/** The index of each label within _labels. */
+	LabelIndexMap _labelIndices;
+
 	friend class GFF3WriterList;
 	friend class GFF3WriterStruct;
 
 	/** Adds a label to the writer and returns the corresponding index. */
 	uint32_t addLabel(const Common::UString &label);
 	/** Get the actual size of the field. */
-	static uint32_t getFieldDataSize(Value field);
+	static uint32_t getFieldDataSize(const Value &field);
+	/** Is this a field type with its value stored in the field itself, instead of the field data? */
+	static bool isSimpleFieldType(GFF3Struct::FieldType type);
 
 	size_t createField(GFF3Struct::FieldType type, const Common::UString &label);
 };
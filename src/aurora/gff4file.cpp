@@ -73,16 +73,16 @@ bool GFF4File::Header::isBigEndian() const {
 }
 
 
-GFF4File::GFF4File(std::unique_ptr<Common::SeekableReadStream> gff4, uint32_t type) :
-	_origStream(std::move(gff4)), _topLevelStruct(0) {
+GFF4File::GFF4File(std::unique_ptr<Common::SeekableReadStream> gff4, uint32_t type, bool lazy) :
+	_origStream(std::move(gff4)), _lazy(lazy), _topLevelStruct(0), _prefetchPass(0) {
 
 	assert(_origStream);
 
 	load(type);
 }
 
-GFF4File::GFF4File(Common::SeekableReadStream *gff4, uint32_t type) :
-	_origStream(gff4), _topLevelStruct(0) {
+GFF4File::GFF4File(Common::SeekableReadStream *gff4, uint32_t type, bool lazy) :
+	_origStream(gff4), _lazy(lazy), _topLevelStruct(0), _prefetchPass(0) {
 
 	assert(_origStream);
 
@@ -230,8 +230,10 @@ void GFF4File::loadStructs() {
 		}
 	}
 
-	/* And load the top level struct, which itself recurses into field structs.
-	 * The top level struct is always constructed using the first template. */
+	/* And load the top level struct, which itself recurses into field structs
+	 * (unless we're loading lazily, then the field structs are only loaded on
+	 * first access). The top level struct is always constructed using the
+	 * first template. */
 	_topLevelStruct = new GFF4Struct(*this, _header.dataOffset, _structTemplates[0]);
 	_topLevelStruct->_refCount++;
 }
@@ -255,7 +257,7 @@ void GFF4File::loadStrings() {
 
 // --- Helpers for GFF4Struct ---
 
-void GFF4File::registerStruct(uint64_t id, GFF4Struct *strct) {
+void GFF4File::registerStruct(uint64_t id, GFF4Struct *strct) const {
 	/* Each struct, on creation, registers itself to the GFF4 files it
 	 * belongs in.
 	 *
@@ -273,11 +275,11 @@ void GFF4File::registerStruct(uint64_t id, GFF4Struct *strct) {
 		throw Common::Exception("GFF4: Duplicate struct");
 }
 
-void GFF4File::unregisterStruct(uint64_t id) {
+void GFF4File::unregisterStruct(uint64_t id) const {
 	_structs.erase(id);
 }
 
-GFF4Struct *GFF4File::findStruct(uint64_t id) {
+GFF4Struct *GFF4File::findStruct(uint64_t id) const {
 	StructMap::iterator s = _structs.find(id);
 	if (s == _structs.end())
 		return 0;
@@ -357,8 +359,8 @@ GFF4Struct::Field::Field(uint32_t l, uint16_t t, uint16_t f, uint32_t o, bool g)
 }
 
 
-GFF4Struct::GFF4Struct(GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt) :
-	_parent(&parent), _label(tmplt.label), _refCount(0), _fieldCount(0) {
+GFF4Struct::GFF4Struct(const GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt) :
+	_parent(&parent), _label(tmplt.label), _refCount(0), _fieldCount(0), _prefetchPass(0) {
 
 	// Constructor for a real struct, from a template
 
@@ -373,8 +375,8 @@ GFF4Struct::GFF4Struct(GFF4File &parent, uint32_t offset, const GFF4File::Struct
 	}
 }
 
-GFF4Struct::GFF4Struct(GFF4File &parent, const Field &genericParent) :
-	_parent(&parent), _label(0), _refCount(0), _fieldCount(0) {
+GFF4Struct::GFF4Struct(const GFF4File &parent, const Field &genericParent) :
+	_parent(&parent), _label(0), _refCount(0), _fieldCount(0), _prefetchPass(0) {
 
 	// Constructor for a generic, converted into a struct
 
@@ -406,13 +408,14 @@ uint32_t GFF4Struct::getLabel() const {
 
 // --- Loader ---
 
-void GFF4Struct::load(GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt) {
+void GFF4Struct::load(const GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt) {
 	/* Loader for a real struct, from a template.
 	 *
 	 * Go through all the fields in the template and create field
 	 * instances within this struct instance. If the field is itself
 	 * a struct, recursively create a new struct instance for it. If
-	 * the field is a generic, create a struct for it as well. */
+	 * the field is a generic, create a struct for it as well. When
+	 * loading lazily, these are instead created on first access. */
 
 	for (size_t i = 0; i < tmplt.fields.size(); i++) {
 		const GFF4File::StructTemplate::Field &field = tmplt.fields[i];
@@ -426,10 +429,11 @@ void GFF4Struct::load(GFF4File &parent, uint32_t offset, const GFF4File::StructT
 
 		// Load the field and its struct(s), if any
 		Field &f = _fields[field.label] = Field(field.label, field.type, field.flags, fieldOffset);
-		if (f.type == kFieldTypeStruct)
-			loadStructs(parent, f);
 		if (f.type == kFieldTypeGeneric)
-			loadGeneric(parent, f);
+			f.offset = getDataOffset(f.isList, f.offset);
+
+		if (!parent._lazy)
+			getStructs(f);
 
 		if ((f.type == kFieldTypeASCIIString) && parent.hasSharedStrings())
 			throw Common::Exception("GFF4: TODO: ASCII string field in a file with shared strings");
@@ -438,7 +442,20 @@ void GFF4Struct::load(GFF4File &parent, uint32_t offset, const GFF4File::StructT
 	_fieldCount = _fields.size();
 }
 
-void GFF4Struct::loadStructs(GFF4File &parent, Field &field) {
+const GFF4List &GFF4Struct::getStructs(const Field &field) const {
+	if (!field.structsLoaded) {
+		if (field.type == kFieldTypeStruct)
+			loadStructs(field);
+		else if (field.type == kFieldTypeGeneric)
+			loadGeneric(field);
+
+		field.structsLoaded = true;
+	}
+
+	return field.structs;
+}
+
+void GFF4Struct::loadStructs(const Field &field) const {
 	if (field.offset == 0xFFFFFFFF)
 		return;
 
@@ -457,6 +474,7 @@ void GFF4Struct::loadStructs(GFF4File &parent, Field &field) {
 	 * can point to the same struct). If that is the case, we don't
 	 * need to load it again. */
 
+	const GFF4File &parent = *_parent;
 	const GFF4File::StructTemplate &tmplt = parent.getStructTemplate(field.structIndex);
 
 	Common::SeekableSubReadStreamEndian &data = parent.getStream(field.offset);
@@ -465,7 +483,9 @@ void GFF4Struct::loadStructs(GFF4File &parent, Field &field) {
 	const uint32_t structSize  = field.isReference ? 4 : tmplt.size;
 	const uint32_t structStart = data.pos();
 
-	field.structs.resize(structCount, 0);
+	/* Only count the references once all structs have been loaded. When loading
+	 * lazily, a failed load can then be retried without counting twice. */
+	std::vector<GFF4Struct *> structs(structCount, 0);
 	for (uint32_t i = 0; i < structCount; i++) {
 		const uint32_t offset = getDataOffset(field.isReference, structStart + i * structSize);
 		if (offset == 0xFFFFFFFF)
@@ -475,29 +495,32 @@ void GFF4Struct::loadStructs(GFF4File &parent, Field &field) {
 		if (!strct)
 			strct = new GFF4Struct(parent, offset, tmplt);
 
-		strct->_refCount++;
-
-		field.structs[i] = strct;
+		structs[i] = strct;
 	}
+
+	for (std::vector<GFF4Struct *>::iterator s = structs.begin(); s != structs.end(); ++s)
+		if (*s)
+			(*s)->_refCount++;
+
+	field.structs.assign(structs.begin(), structs.end());
 }
 
-void GFF4Struct::loadGeneric(GFF4File &parent, Field &field) {
-	field.offset = getDataOffset(field.isList, field.offset);
+void GFF4Struct::loadGeneric(const Field &field) const {
 	if (field.offset == 0xFFFFFFFF)
 		return;
 
 	// Loader for fields of generic type. We map the generic to a struct.
 
-	GFF4Struct *strct = parent.findStruct(generateID(field.offset));
+	GFF4Struct *strct = _parent->findStruct(generateID(field.offset));
 	if (!strct)
-		strct = new GFF4Struct(parent, field);
+		strct = new GFF4Struct(*_parent, field);
 
 	strct->_refCount++;
 
-	field.structs.push_back(strct);
+	field.structs.assign(1, strct);
 }
 
-void GFF4Struct::load(GFF4File &parent, const Field &genericParent) {
+void GFF4Struct::load(const GFF4File &parent, const Field &genericParent) {
 	/* Loader for generic, converting it into a struct.
 	 *
 	 * Go through all the elements of the generic and create fields
@@ -527,11 +550,12 @@ void GFF4Struct::load(GFF4File &parent, const Field &genericParent) {
 
 		// Load the field and its struct(s), if any
 		Field &f = _fields[i] = Field(i, fieldType, fieldFlags, fieldOffset, true);
-		if (f.type == kFieldTypeStruct)
-			loadStructs(parent, f);
 		if (f.type == kFieldTypeGeneric)
 			throw Common::Exception("GFF4: Found a generic with type generic?");
 
+		if (!parent._lazy)
+			getStructs(f);
+
 		if ((f.type == kFieldTypeASCIIString) && parent.hasSharedStrings())
 			throw Common::Exception("GFF4: TODO: ASCII string field in a file with shared strings");
 	}
@@ -1322,8 +1346,9 @@ const GFF4Struct *GFF4Struct::getStruct(uint32_t field) const {
 	if (f->isList)
 		throw Common::Exception("GFF4: Tried reading list as singular value");
 
-	if (!f->structs.empty())
-		return f->structs[0];
+	const GFF4List &structs = getStructs(*f);
+	if (!structs.empty())
+		return structs[0];
 
 	return 0;
 }
@@ -1338,8 +1363,9 @@ const GFF4Struct *GFF4Struct::getGeneric(uint32_t field) const {
 	if (f->type != kFieldTypeGeneric)
 		throw Common::Exception("GFF4: Field is not of generic type");
 
-	if (!f->structs.empty())
-		return f->structs[0];
+	const GFF4List &structs = getStructs(*f);
+	if (!structs.empty())
+		return structs[0];
 
 	return 0;
 }
@@ -1354,7 +1380,41 @@ const GFF4List &GFF4Struct::getList(uint32_t field) const {
 	if (f->type != kFieldTypeStruct)
 		throw Common::Exception("GFF4: Field is not of struct type");
 
-	return f->structs;
+	return getStructs(*f);
+}
+
+// --- Prefetching ---
+
+void GFF4Struct::prefetch() const {
+	if (!_parent->_lazy)
+		return;
+
+	/* Walk through the branch below this struct without recursion. Structs
+	 * can be referenced several times, even in loops, so we mark each struct
+	 * we visit with the number of this prefetch pass. */
+
+	const uint32_t pass = ++_parent->_prefetchPass;
+
+	std::vector<const GFF4Struct *> pending(1, this);
+	_prefetchPass = pass;
+
+	while (!pending.empty()) {
+		const GFF4Struct &strct = *pending.back();
+		pending.pop_back();
+
+		for (FieldMap::const_iterator f = strct._fields.begin(); f != strct._fields.end(); ++f) {
+			if ((f->second.type != kFieldTypeStruct) && (f->second.type != kFieldTypeGeneric))
+				continue;
+
+			const GFF4List &structs = strct.getStructs(f->second);
+
+			for (GFF4List::const_iterator child = structs.begin(); child != structs.end(); ++child)
+				if (*child && ((*child)->_prefetchPass != pass)) {
+					(*child)->_prefetchPass = pass;
+					pending.push_back(*child);
+				}
+		}
+	}
 }
 
 // --- Struct data reader ---
@@ -76,6 +76,15 @@ class GFF4Struct;
  *  reference a string within this table, so that duplicated strings don't
  *  need to be stored multiple times.
  *
+ *  By default, all structs of the GFF4 are decoded when the file is loaded.
+ *  When the constructor parameter lazy is set to true, only the top-level
+ *  struct is decoded, and every other struct is decoded when it is first
+ *  reached through getStruct(), getGeneric() or getList(). This is useful
+ *  when only a few fields of a large GFF4 are needed. Since the references
+ *  to a struct are then only counted once they are followed, the reference
+ *  count of a struct in a lazily loaded GFF4 is only a lower bound. To decode
+ *  a whole branch of a lazy GFF4 in one go, see GFF4Struct::prefetch().
+ *
  *  Notes:
  *  - Generics and lists of generics are mapped to structs, with the field ID
  *    being the list element indices (or just 0 on non-list generics).
@@ -92,9 +101,9 @@ class GFF4Struct;
 class GFF4File : boost::noncopyable, public AuroraFile {
 public:
 	/** Read a GFF4 file out of the stream. */
-	GFF4File(std::unique_ptr<Common::SeekableReadStream> gff4, uint32_t type = 0xFFFFFFFF);
+	GFF4File(std::unique_ptr<Common::SeekableReadStream> gff4, uint32_t type = 0xFFFFFFFF, bool lazy = false);
 	/** Take over this stream and read a GFF4 file out of it. */
-	GFF4File(Common::SeekableReadStream *gff4, uint32_t type = 0xFFFFFFFF);
+	GFF4File(Common::SeekableReadStream *gff4, uint32_t type = 0xFFFFFFFF, bool lazy = false);
 	~GFF4File();
 
 	/** Return the GFF4's specific type. */
@@ -169,11 +178,17 @@ private:
 	/** The shared strings used in V4.1. */
 	SharedStrings _sharedStrings;
 
-	/** All actual structs in this GFF4. */
-	StructMap   _structs;
+	/** Only decode structs when they're first reached? */
+	bool _lazy;
+
+	/** All actual structs in this GFF4 decoded so far. */
+	mutable StructMap _structs;
 	/** The top-level struct. */
 	GFF4Struct *_topLevelStruct;
 
+	/** The number of the last GFF4Struct::prefetch() pass. */
+	mutable uint32_t _prefetchPass;
+
 
 	// .--- Loading helpers
 	void load(uint32_t type);
@@ -185,9 +200,9 @@ private:
 	// '---
 
 	// .--- Helper methods called by GFF4Struct
-	void registerStruct(uint64_t id, GFF4Struct *strct);
-	void unregisterStruct(uint64_t id);
-	GFF4Struct *findStruct(uint64_t id);
+	void registerStruct(uint64_t id, GFF4Struct *strct) const;
+	void unregisterStruct(uint64_t id) const;
+	GFF4Struct *findStruct(uint64_t id) const;
 
 	Common::SeekableSubReadStreamEndian &getStream(uint32_t offset) const;
 	const StructTemplate &getStructTemplate(uint32_t i) const;
@@ -230,7 +245,11 @@ public:
 
 	/** Return the struct's unique ID within the GFF4. */
 	uint64_t getID() const;
-	/** Return the number of structs that refer to this struct. */
+	/** Return the number of structs that refer to this struct.
+	 *
+	 *  In a lazily loaded GFF4, only references that have already been
+	 *  followed are counted.
+	 */
 	uint32_t getRefCount() const;
 
 	/** Return the struct's label.
@@ -338,6 +357,15 @@ public:
 	const GFF4List   &getList   (uint32_t field) const;
 	// '---
 
+	/** Decode all structs reachable from this struct.
+	 *
+	 *  In a GFF4 that was loaded lazily, this decodes the whole branch below
+	 *  this struct in one go, instead of each struct on first access. In a
+	 *  GFF4 that was loaded normally, all structs are already decoded and
+	 *  this does nothing.
+	 */
+	void prefetch() const;
+
 	// .--- Raw data
 	/** Return the raw data of the field as a Seekable(Sub)ReadStream. Dangerous. */
 	Common::SeekableReadStream *getData(uint32_t field) const;
@@ -355,7 +383,9 @@ private:
 		bool isGeneric { false };   ///< Is this field found in a generic?
 
 		uint16_t structIndex { 0 }; ///< Index of the field's struct type (if kFieldTypeStruct).
-		GFF4List structs;           ///< List of GFF4Struct (if kFieldTypeStruct).
+
+		mutable GFF4List structs;              ///< List of GFF4Struct (if kFieldTypeStruct or kFieldTypeGeneric).
+		mutable bool structsLoaded { false };  ///< Have the structs already been decoded?
 
 		Field() = default;
 		Field(const Field &) = default;
@@ -382,19 +412,25 @@ private:
 	/** The labels of all fields in this struct. */
 	std::vector<uint32_t> _fieldLabels;
 
+	/** The number of the last prefetch() pass that visited this struct. */
+	mutable uint32_t _prefetchPass;
+
 
 	// .--- Loader
 	/** Load a GFF4 struct. */
-	GFF4Struct(GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt);
+	GFF4Struct(const GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt);
 	/** Load a GFF4 generic as a struct. */
-	GFF4Struct(GFF4File &parent, const Field &genericParent);
+	GFF4Struct(const GFF4File &parent, const Field &genericParent);
 	~GFF4Struct();
 
-	void load(GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt);
-	void loadStructs(GFF4File &parent, Field &field);
-	void loadGeneric(GFF4File &parent, Field &field);
+	void load(const GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt);
+	void loadStructs(const Field &field) const;
+	void loadGeneric(const Field &field) const;
+
+	void load(const GFF4File &parent, const Field &genericParent);
 
-	void load(GFF4File &parent, const Field &genericParent);
+	/** Return the structs of this struct or generic field, decoding them if necessary. */
+	const GFF4List &getStructs(const Field &field) const;
 
 	static uint64_t generateID(uint32_t offset, const GFF4File::StructTemplate *tmplt = 0);
 	// '---
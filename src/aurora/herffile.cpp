@@ -152,7 +152,7 @@ const HERFFile::IResource &HERFFile::getIResource(uint32_t index) const {
 	return _iResources[index];
 }
 
-uint32_t HERFFile::getResourceSize(uint32_t index) const {
+uint64_t HERFFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).size;
 }
 
@@ -160,11 +160,9 @@ Common::SeekableReadStream *HERFFile::getResource(uint32_t index, bool tryNoCopy
 	const IResource &res = getIResource(index);
 
 	if (tryNoCopy)
-		return new Common::SeekableSubReadStream(_herf.get(), res.offset, res.offset + res.size);
+		return _herf->getSubStream(res.offset, res.offset + res.size);
 
-	_herf->seek(res.offset);
-
-	return _herf->readStream(res.size);
+	return _herf->readStreamAt(res.offset, res.size);
 }
 
 Common::HashAlgo HERFFile::getNameHashAlgo() const {
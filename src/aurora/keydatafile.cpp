@@ -0,0 +1,79 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An abstract KEY data file (BIF or BZF).
+ */
+
+#include <atomic>
+#include <memory>
+#include <future>
+
+#include "src/common/util.h"
+#include "src/common/readstream.h"
+#include "src/common/threadpool.h"
+
+#include "src/aurora/keydatafile.h"
+
+namespace Aurora {
+
+void KEYDataFile::readResources(ResourceBufferList &resources, Common::ThreadPool &pool) const {
+	readResourcesParallel(resources, pool, [this]() -> ResourceReader {
+		return [this](ResourceBuffer &resource) {
+			std::unique_ptr<Common::SeekableReadStream> stream(getResource(resource.index, true));
+
+			stream->readChecked(resource.data, getResourceSize(resource.index));
+		};
+	});
+}
+
+void KEYDataFile::readResourcesParallel(ResourceBufferList &resources, Common::ThreadPool &pool,
+                                        const std::function<ResourceReader()> &createReader) {
+
+	std::atomic<size_t> next(0);
+
+	const size_t jobCount = MIN(pool.getThreadCount(), resources.size());
+
+	std::vector<std::future<void>> jobs;
+	jobs.reserve(jobCount);
+
+	for (size_t i = 0; i < jobCount; i++) {
+		jobs.push_back(pool.addJob([&resources, &next, &createReader]() {
+			ResourceReader reader = createReader();
+
+			for (size_t n = next++; n < resources.size(); n = next++) {
+				try {
+					reader(resources[n]);
+				} catch (...) {
+					resources[n].error = std::current_exception();
+				}
+			}
+		}));
+	}
+
+	// All jobs need to be finished before anything goes out of scope, even if one of them failed
+	for (std::vector<std::future<void>>::iterator j = jobs.begin(); j != jobs.end(); ++j)
+		j->wait();
+
+	for (std::vector<std::future<void>>::iterator j = jobs.begin(); j != jobs.end(); ++j)
+		j->get();
+}
+
+} // End of namespace Aurora
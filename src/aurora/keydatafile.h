@@ -25,10 +25,19 @@
 #ifndef AURORA_KEYDATAFILE_H
 #define AURORA_KEYDATAFILE_H
 
+#include <vector>
+#include <exception>
+#include <functional>
+
 #include "src/common/types.h"
 
 #include "src/aurora/archive.h"
 
+namespace Common {
+	class WriteStream;
+	class ThreadPool;
+}
+
 namespace Aurora {
 
 class KEYFile;
@@ -49,6 +58,50 @@ public:
 	 *  @param dataFileIndex The index this data file has within the KEY file.
 	 */
 	virtual void mergeKEY(const KEYFile &key, uint32_t dataFileIndex) = 0;
+
+	/** Write the resource index of this data file into a stream.
+	 *
+	 *  The index holds both the data file's own resource table and the
+	 *  information already merged in from KEY files. It can be handed back
+	 *  to the data file's constructor, to skip reading the resource table
+	 *  and merging the KEYs again.
+	 */
+	virtual void writeIndex(Common::WriteStream &index) const = 0;
+
+	/** A resource to be read by readResources(). */
+	struct ResourceBuffer {
+		uint32_t index; ///< The index of the resource to read.
+		byte *data;     ///< The buffer to read into, at least getResourceSize() bytes large.
+
+		std::exception_ptr error; ///< The reason reading this resource failed, if it did.
+
+		ResourceBuffer(uint32_t i = 0xFFFFFFFF, byte *d = 0) : index(i), data(d) { }
+	};
+
+	typedef std::vector<ResourceBuffer> ResourceBufferList;
+
+	/** Read the contents of several resources at once, into caller-provided buffers.
+	 *
+	 *  The resources are distributed over the worker threads of the pool, and this
+	 *  only returns once all of them have been read. A resource that couldn't be
+	 *  read has its error set, while the other resources are still read.
+	 *
+	 *  This must not be called from a job running on the same pool.
+	 */
+	virtual void readResources(ResourceBufferList &resources, Common::ThreadPool &pool) const;
+
+protected:
+	/** A function reading one resource into its buffer. */
+	typedef std::function<void(ResourceBuffer &)> ResourceReader;
+
+	/** Read resources on the worker threads of the pool.
+	 *
+	 *  One job per worker thread is started. Each job calls createReader() once,
+	 *  then reads resources with the returned function until none are left. This
+	 *  way, a reader can keep state, like a decompressor, from one resource to the next.
+	 */
+	static void readResourcesParallel(ResourceBufferList &resources, Common::ThreadPool &pool,
+	                                  const std::function<ResourceReader()> &createReader);
 };
 
 } // End of namespace Aurora
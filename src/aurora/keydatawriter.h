@@ -49,6 +49,13 @@ public:
 	 * @param type the type of this data
 	 */
 	virtual void add(Common::SeekableReadStream &data, FileType type) = 0;
+
+	/**
+	 * Get the number of bytes that weren't written, because
+	 * they were the same data as a file added before.
+	 * @return the number of bytes saved by deduplication
+	 */
+	virtual uint64_t getBytesSaved() const = 0;
 };
 
 } // End of namespace Aurora
@@ -26,13 +26,17 @@
  * (<https://github.com/xoreos/xoreos-docs/tree/master/specs/bioware>)
  */
 
+#include <memory>
+
 #include "src/common/util.h"
 #include "src/common/strutil.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
+#include "src/common/writestream.h"
 #include "src/common/encoding.h"
 
 #include "src/aurora/keyfile.h"
+#include "src/aurora/util.h"
 
 static const uint32_t kKEYID     = MKTAG('K', 'E', 'Y', ' ');
 static const uint32_t kVersion1  = MKTAG('V', '1', ' ', ' ');
@@ -44,6 +48,9 @@ KEYFile::KEYFile(Common::SeekableReadStream &key) {
 	load(key);
 }
 
+KEYFile::KEYFile() {
+}
+
 KEYFile::~KEYFile() {
 }
 
@@ -80,6 +87,8 @@ void KEYFile::load(Common::SeekableReadStream &key) {
 		_resources.resize(resCount);
 		readResList(key, offResTable);
 
+		groupResources();
+
 	} catch (Common::Exception &e) {
 		e.add("Failed reading KEY file");
 		throw;
@@ -138,6 +147,23 @@ void KEYFile::readResList(Common::SeekableReadStream &key, uint32_t offset) {
 	}
 }
 
+void KEYFile::groupResources() {
+	std::vector<uint32_t> counts(_bifs.size(), 0);
+	for (ResourceList::const_iterator res = _resources.begin(); res != _resources.end(); ++res)
+		if (res->bifIndex < counts.size())
+			counts[res->bifIndex]++;
+
+	_bifResources.clear();
+	_bifResources.resize(_bifs.size());
+
+	for (size_t i = 0; i < _bifResources.size(); i++)
+		_bifResources[i].reserve(counts[i]);
+
+	for (size_t i = 0; i < _resources.size(); i++)
+		if (_resources[i].bifIndex < _bifResources.size())
+			_bifResources[_resources[i].bifIndex].push_back(i);
+}
+
 const KEYFile::BIFList &KEYFile::getBIFs() const {
 	return _bifs;
 }
@@ -146,4 +172,60 @@ const KEYFile::ResourceList &KEYFile::getResources() const {
 	return _resources;
 }
 
+const KEYFile::ResourceIndexList &KEYFile::getBIFResources(uint32_t bifIndex) const {
+	static const ResourceIndexList kEmpty;
+
+	if (bifIndex >= _bifResources.size())
+		return kEmpty;
+
+	return _bifResources[bifIndex];
+}
+
+void KEYFile::writeIndex(Common::WriteStream &index) const {
+	index.writeUint32BE(_id);
+	index.writeUint32BE(_version);
+
+	index.writeUint32LE(_bifs.size());
+	for (BIFList::const_iterator bif = _bifs.begin(); bif != _bifs.end(); ++bif)
+		Common::writeString(index, *bif, Common::kEncodingUTF8, true);
+
+	index.writeUint32LE(_resources.size());
+	for (ResourceList::const_iterator res = _resources.begin(); res != _resources.end(); ++res) {
+		Common::writeString(index, res->name, Common::kEncodingUTF8, true);
+
+		index.writeUint32LE((uint32_t) res->type);
+		index.writeUint32LE(res->bifIndex);
+		index.writeUint32LE(res->resIndex);
+	}
+}
+
+KEYFile *KEYFile::readIndex(Common::SeekableReadStream &index) {
+	std::unique_ptr<KEYFile> key(new KEYFile);
+
+	key->_id      = index.readUint32BE();
+	key->_version = index.readUint32BE();
+
+	if (key->_id != kKEYID)
+		throw Common::Exception("Not a KEY index (%s)", Common::debugTag(key->_id).c_str());
+
+	// A BIF name takes at least its terminating 0 byte
+	key->_bifs.resize(readIndexCount(index, 1));
+	for (BIFList::iterator bif = key->_bifs.begin(); bif != key->_bifs.end(); ++bif)
+		*bif = Common::readString(index, Common::kEncodingUTF8);
+
+	// A resource takes at least the terminating 0 byte of its name and three uint32s
+	key->_resources.resize(readIndexCount(index, 13));
+	for (ResourceList::iterator res = key->_resources.begin(); res != key->_resources.end(); ++res) {
+		res->name = Common::readString(index, Common::kEncodingUTF8);
+
+		res->type     = (FileType) index.readUint32LE();
+		res->bifIndex = index.readUint32LE();
+		res->resIndex = index.readUint32LE();
+	}
+
+	key->groupResources();
+
+	return key.release();
+}
+
 } // End of namespace Aurora
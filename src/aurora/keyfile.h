@@ -37,6 +37,7 @@
 
 namespace Common {
 	class SeekableReadStream;
+	class WriteStream;
 }
 
 namespace Aurora {
@@ -81,6 +82,9 @@ public:
 	typedef std::vector<Resource> ResourceList;
 	typedef std::vector<Common::UString> BIFList;
 
+	/** A list of indices into the resource list. */
+	typedef std::vector<uint32_t> ResourceIndexList;
+
 	KEYFile(Common::SeekableReadStream &key);
 	~KEYFile();
 
@@ -90,14 +94,30 @@ public:
 	/** Return a list of all containing resources. */
 	const ResourceList &getResources() const;
 
+	/** Return the indices of all resources found in this bif, in KEY order. */
+	const ResourceIndexList &getBIFResources(uint32_t bifIndex) const;
+
+	/** Write the BIF list and the resource list of this KEY into a stream. */
+	void writeIndex(Common::WriteStream &index) const;
+
+	/** Create a KEYFile out of a stream written by writeIndex(). */
+	static KEYFile *readIndex(Common::SeekableReadStream &index);
+
 private:
 	BIFList      _bifs;      ///< All managed bifs.
 	ResourceList _resources; ///< All containing resources.
 
+	/** The indices of the resources in each bif. */
+	std::vector<ResourceIndexList> _bifResources;
+
+	KEYFile();
+
 	void load(Common::SeekableReadStream &key);
 
 	void readBIFList(Common::SeekableReadStream &key, uint32_t offset);
 	void readResList(Common::SeekableReadStream &key, uint32_t offset);
+
+	void groupResources();
 };
 
 } // End of namespace Aurora
@@ -159,21 +159,17 @@ const NDSFile::IResource &NDSFile::getIResource(uint32_t index) const {
 	return _iResources[index];
 }
 
-uint32_t NDSFile::getResourceSize(uint32_t index) const {
+uint64_t NDSFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).size;
 }
 
 Common::SeekableReadStream *NDSFile::getResource(uint32_t index, bool tryNoCopy) const {
 	const IResource &res = getIResource(index);
 
-	_nds->seek(res.offset);
-
 	if (tryNoCopy)
-		return new Common::SeekableSubReadStream(_nds.get(), res.offset, res.offset + res.size);
-
-	_nds->seek(res.offset);
+		return _nds->getSubStream(res.offset, res.offset + res.size);
 
-	return _nds->readStream(res.size);
+	return _nds->readStreamAt(res.offset, res.size);
 }
 
 } // End of namespace Aurora
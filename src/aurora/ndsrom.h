@@ -57,7 +57,7 @@ public:
 	const ResourceList &getResources() const;
 
 	/** Return the size of a resource. */
-	uint32_t getResourceSize(uint32_t index) const;
+	uint64_t getResourceSize(uint32_t index) const;
 
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
@@ -76,8 +76,8 @@ public:
 private:
 	/** Internal resource information. */
 	struct IResource {
-		uint32_t offset; ///< The offset of the resource within the NDS.
-		uint32_t size;   ///< The resource's size.
+		uint64_t offset; ///< The offset of the resource within the NDS.
+		uint64_t size;   ///< The resource's size.
 	};
 
 	typedef std::vector<IResource> IResourceList;
@@ -100,7 +100,7 @@ uint32_t NSBTXFile::getITEXSize(const Texture &texture) {
 	return kXEOSITEXHeaderSize + kXEOSITEXMipMapHeaderSize + texture.width * texture.height * 4;
 }
 
-uint32_t NSBTXFile::getResourceSize(uint32_t index) const {
+uint64_t NSBTXFile::getResourceSize(uint32_t index) const {
 	if (index >= _textures.size())
 		throw Common::Exception("Texture index out of range (%u/%u)", index, (uint)_textures.size());
 
@@ -23,6 +23,9 @@
  */
 
 #include <cassert>
+#include <cstring>
+
+#include <boost/noncopyable.hpp>
 
 #include "src/common/util.h"
 #include "src/common/strutil.h"
@@ -34,8 +37,101 @@
 #include "src/aurora/obbfile.h"
 #include "src/aurora/util.h"
 
+/** The size of one decompressed chunk. */
+static const size_t kChunkSize = 4096;
+/** The most a compressed chunk can take up. zlib never needs much more than the input size. */
+static const size_t kMaxPackedChunkSize = 2 * kChunkSize;
+
 namespace Aurora {
 
+/** A stream inflating the chunks of an OBB resource on demand. */
+class OBBFile::ResourceStream : boost::noncopyable, public Common::SeekableReadStream {
+public:
+	ResourceStream(const OBBFile &obb, uint32_t index) : _obb(&obb), _index(index),
+		_size(obb.getResourceSize(index)), _pos(0), _eos(false), _cachedChunk(SIZE_MAX) {
+
+	}
+
+	bool eos() const {
+		return _eos;
+	}
+
+	size_t pos() const {
+		return _pos;
+	}
+
+	size_t size() const {
+		return _size;
+	}
+
+	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin) {
+		const size_t oldPos = _pos;
+		const size_t newPos = evalSeek(offset, whence, _pos, 0, _size);
+		if (newPos > _size)
+			throw Common::Exception(Common::kSeekError);
+
+		_pos = newPos;
+		_eos = false;
+
+		return oldPos;
+	}
+
+	size_t read(void *dataPtr, size_t dataSize) {
+		assert(dataPtr);
+
+		if (dataSize > (_size - _pos)) {
+			dataSize = _size - _pos;
+			_eos = true;
+		}
+
+		byte *data = reinterpret_cast<byte *>(dataPtr);
+
+		size_t left = dataSize;
+		while (left > 0) {
+			const size_t chunk  = _pos / kChunkSize;
+			const size_t offset = _pos % kChunkSize;
+
+			if ((offset == 0) && (left >= kChunkSize)) {
+				// Inflate a whole chunk directly into the output buffer
+				const size_t count = _obb->readChunk(_index, chunk, data);
+
+				data  += count;
+				_pos  += count;
+				left  -= count;
+				continue;
+			}
+
+			// Partially read a chunk through the cache
+			if (_cachedChunk != chunk) {
+				_obb->readChunk(_index, chunk, _cache);
+				_cachedChunk = chunk;
+			}
+
+			const size_t count = MIN<size_t>(left, kChunkSize - offset);
+
+			std::memcpy(data, _cache + offset, count);
+
+			data  += count;
+			_pos  += count;
+			left  -= count;
+		}
+
+		return dataSize;
+	}
+
+private:
+	const OBBFile *_obb;
+	uint32_t _index;
+
+	size_t _size;
+	size_t _pos;
+	bool _eos;
+
+	size_t _cachedChunk;
+	byte _cache[kChunkSize];
+};
+
+
 OBBFile::OBBFile(Common::SeekableReadStream *obb) : _obb(obb) {
 	assert(_obb);
 
@@ -100,6 +196,9 @@ void OBBFile::readResList(Common::SeekableReadStream &index) {
 
 		_resources.push_back(res);
 		_iResources.push_back(iRes);
+
+		// The first chunk starts at the resource's offset
+		_chunkOffsets.push_back(std::vector<uint64_t>(1, iRes.offset));
 	}
 }
 
@@ -161,10 +260,77 @@ const OBBFile::IResource &OBBFile::getIResource(uint32_t index) const {
 	return _iResources[index];
 }
 
-uint32_t OBBFile::getResourceSize(uint32_t index) const {
+uint64_t OBBFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).uncompressedSize;
 }
 
+uint64_t OBBFile::getChunkOffset(uint32_t index, size_t chunk) const {
+	size_t knownChunks = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(_chunkMutex);
+
+		const std::vector<uint64_t> &offsets = _chunkOffsets[index];
+		if (chunk < offsets.size())
+			return offsets[chunk];
+
+		knownChunks = offsets.size();
+	}
+
+	// Inflate the chunks in front of this one, to find out where they end
+	std::unique_ptr<byte[]> scratch = std::make_unique<byte[]>(kChunkSize);
+	for (size_t i = knownChunks - 1; i < chunk; i++)
+		readChunk(index, i, scratch.get());
+
+	std::lock_guard<std::mutex> lock(_chunkMutex);
+
+	return _chunkOffsets[index][chunk];
+}
+
+size_t OBBFile::readChunk(uint32_t index, size_t chunk, byte *output) const {
+	const IResource &res = getIResource(index);
+
+	const size_t chunkStart = chunk * kChunkSize;
+	if (chunkStart >= res.uncompressedSize)
+		throw Common::Exception("Chunk index out of range (%u/%u)",
+		                        (uint)chunk, (uint)((res.uncompressedSize + kChunkSize - 1) / kChunkSize));
+
+	const size_t outputSize = MIN<size_t>(res.uncompressedSize - chunkStart, kChunkSize);
+	const uint64_t offset   = getChunkOffset(index, chunk);
+
+	/* We don't know how large the compressed chunk is, so we read as much
+	 * as it can possibly take up. */
+
+	if (offset >= _obb->size())
+		throw Common::Exception("Chunk offset out of range (%s/%u)",
+		                        Common::composeString(offset).c_str(), (uint)_obb->size());
+
+	const size_t packedSize = MIN<size_t>(_obb->size() - offset, kMaxPackedChunkSize);
+	std::unique_ptr<byte[]> packed = std::make_unique<byte[]>(packedSize);
+
+	if (_obb->readAt(offset, packed.get(), packedSize) != packedSize)
+		throw Common::Exception(Common::kReadError);
+
+	Common::MemoryReadStream packedStream(packed.get(), packedSize);
+
+	const size_t bytesChunk =
+		Common::decompressDeflateChunk(packedStream, Common::kWindowBitsMax, output, outputSize, packedSize);
+
+	if (bytesChunk != outputSize)
+		throw Common::Exception("Chunk size mismatch (%u/%u)", (uint)bytesChunk, (uint)outputSize);
+
+	// Now we know where the next chunk starts
+	if ((chunkStart + outputSize) < res.uncompressedSize) {
+		std::lock_guard<std::mutex> lock(_chunkMutex);
+
+		std::vector<uint64_t> &offsets = _chunkOffsets[index];
+		if (offsets.size() == (chunk + 1))
+			offsets.push_back(offset + packedStream.pos());
+	}
+
+	return bytesChunk;
+}
+
 Common::SeekableReadStream *OBBFile::getResource(uint32_t index, bool UNUSED(tryNoCopy)) const {
 	/* Decompress a single file.
 	 *
@@ -175,7 +341,9 @@ Common::SeekableReadStream *OBBFile::getResource(uint32_t index, bool UNUSED(try
 	 * Since we know the starting offset of the first chunk of the file, and
 	 * the uncompressed data size, we simple decompress one chunk after the
 	 * other, starting with the first of the file. Once we have decompressed
-	 * as many bytes as the uncompressed size, we know we're done.
+	 * as many bytes as the uncompressed size, we know we're done. On the way,
+	 * we note down where each chunk starts, so that later reads can jump
+	 * straight to any chunk.
 	 *
 	 * The OBB virtual filesystem also has a chunk list and extra 16 bytes of
 	 * meta data at the end of the last compressed chunk, but we don't really
@@ -191,23 +359,18 @@ Common::SeekableReadStream *OBBFile::getResource(uint32_t index, bool UNUSED(try
 
 	const IResource &res = getIResource(index);
 
-	_obb->seek(res.offset);
-
 	std::unique_ptr<byte[]> data = std::make_unique<byte[]>(res.uncompressedSize);
 
-	size_t offset = 0;
-	size_t bytesLeft = res.uncompressedSize;
+	for (size_t offset = 0, chunk = 0; offset < res.uncompressedSize; offset += kChunkSize, chunk++)
+		readChunk(index, chunk, data.get() + offset);
 
-	while (bytesLeft > 0) {
-		const size_t bytesChunk =
-			Common::decompressDeflateChunk(*_obb, Common::kWindowBitsMax,
-			                               data.get() + offset, bytesLeft, 4096);
+	return new Common::MemoryReadStream(data.release(), res.uncompressedSize, true);
+}
 
-		offset    += bytesChunk;
-		bytesLeft -= bytesChunk;
-	}
+Common::ReadStream *OBBFile::getResourceStream(uint32_t index, bool UNUSED(tryNoCopy)) const {
+	getIResource(index);
 
-	return new Common::MemoryReadStream(data.release(), res.uncompressedSize, true);
+	return new ResourceStream(*this, index);
 }
 
 } // End of namespace Aurora
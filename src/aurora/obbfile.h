@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #include "src/common/types.h"
 
@@ -35,6 +36,7 @@
 #include "src/aurora/aurorafile.h"
 
 namespace Common {
+	class ReadStream;
 	class SeekableReadStream;
 }
 
@@ -63,17 +65,27 @@ public:
 	const ResourceList &getResources() const;
 
 	/** Return the size of a resource. */
-	uint32_t getResourceSize(uint32_t index) const;
+	uint64_t getResourceSize(uint32_t index) const;
 
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
 
+	/** Return a seekable stream inflating the resource's chunks on demand.
+	 *
+	 *  Reading any byte range of the resource only inflates the chunks
+	 *  covering that range, once the offsets of these chunks are known.
+	 *  The stream needs this OBBFile to stay alive.
+	 */
+	Common::ReadStream *getResourceStream(uint32_t index, bool tryNoCopy = false) const;
+
 private:
+	class ResourceStream;
+
 	/** Internal resource information. */
 	struct IResource {
-		uint32_t offset;           ///< The offset of the resource within the OBB.
-		uint32_t uncompressedSize; ///< The resource's uncompressed size.
-		uint32_t compressedSize;   ///< The resource's compressed size.
+		uint64_t offset;           ///< The offset of the resource within the OBB.
+		uint64_t uncompressedSize; ///< The resource's uncompressed size.
+		uint64_t compressedSize;   ///< The resource's compressed size.
 	};
 
 	typedef std::vector<IResource> IResourceList;
@@ -86,12 +98,26 @@ private:
 	/** Internal list of resource offsets and sizes. */
 	IResourceList _iResources;
 
+	/** The offsets of the compressed chunks of each resource, as far as they are known yet.
+	 *
+	 *  Since the size of a compressed chunk is only known once it has been
+	 *  inflated, this table is filled in as the chunks are read.
+	 */
+	mutable std::vector<std::vector<uint64_t>> _chunkOffsets;
+	/** Mutex protecting the chunk offset table. */
+	mutable std::mutex _chunkMutex;
+
 	void load(Common::SeekableReadStream &obb);
 	void readResList(Common::SeekableReadStream &index);
 
 	Common::SeekableReadStream *getIndex(Common::SeekableReadStream &obb);
 
 	const IResource &getIResource(uint32_t index) const;
+
+	/** Return the offset of a compressed chunk, inflating the chunks before it to find it if necessary. */
+	uint64_t getChunkOffset(uint32_t index, size_t chunk) const;
+	/** Inflate a chunk of a resource, returning the number of bytes written into output. */
+	size_t readChunk(uint32_t index, size_t chunk, byte *output) const;
 };
 
 } // End of namespace Aurora
@@ -101,7 +101,7 @@ const RIMFile::IResource &RIMFile::getIResource(uint32_t index) const {
 	return _iResources[index];
 }
 
-uint32_t RIMFile::getResourceSize(uint32_t index) const {
+uint64_t RIMFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).size;
 }
 
@@ -109,11 +109,9 @@ Common::SeekableReadStream *RIMFile::getResource(uint32_t index, bool tryNoCopy)
 	const IResource &res = getIResource(index);
 
 	if (tryNoCopy)
-		return new Common::SeekableSubReadStream(_rim.get(), res.offset, res.offset + res.size);
+		return _rim->getSubStream(res.offset, res.offset + res.size);
 
-	_rim->seek(res.offset);
-
-	return _rim->readStream(res.size);
+	return _rim->readStreamAt(res.offset, res.size);
 }
 
 } // End of namespace Aurora
@@ -25,15 +25,19 @@
 #include "src/common/encoding.h"
 
 #include "src/aurora/rimwriter.h"
+#include "src/aurora/deduplicator.h"
 
 static const uint32_t kRIMID     = MKTAG('R', 'I', 'M', ' ');
 static const uint32_t kVersion1  = MKTAG('V', '1', '.', '0');
 
 namespace Aurora {
 
-RIMWriter::RIMWriter(uint32_t fileCount, Common::SeekableWriteStream &stream) :
+RIMWriter::RIMWriter(uint32_t fileCount, Common::SeekableWriteStream &stream, bool deduplicate) :
 	_fileCount(fileCount), _currentFileCount(0), _stream(stream) {
 
+	if (deduplicate)
+		_deduplicator = std::make_unique<ResourceDeduplicator>();
+
 	// Write magic id
 	_stream.writeUint32BE(kRIMID);
 
@@ -60,14 +64,37 @@ RIMWriter::RIMWriter(uint32_t fileCount, Common::SeekableWriteStream &stream) :
 	_offsetToResourceTable = 120;
 }
 
-void RIMWriter::add(const Common::UString &resRef, FileType resType, Common::ReadStream &stream) {
+RIMWriter::~RIMWriter() {
+}
+
+void RIMWriter::add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
 	if (_currentFileCount >= _fileCount)
 		throw Common::Exception("RIMWriter::add() exceeded file count");
 
-	// Write resource data
-	_stream.seek(_offsetToResourceData);
+	const uint32_t duplicate = _deduplicator ?
+		_deduplicator->find(stream, _currentFileCount) : ResourceDeduplicator::kNoDuplicate;
+
+	uint32_t offset = _offsetToResourceData;
+	uint32_t size   = 0;
+
+	if (duplicate != ResourceDeduplicator::kNoDuplicate) {
+		// Point to the data of the identical file written before
+		const ResourceDeduplicator::Location location = _deduplicator->reuseLocation(duplicate);
+
+		offset = location.offset;
+		size   = location.size;
 
-	uint32_t size = _stream.writeStream(stream);
+	} else {
+		// Write resource data
+		_stream.seek(_offsetToResourceData);
+
+		size = _stream.writeStream(stream);
+
+		if (_deduplicator)
+			_deduplicator->setLocation(_currentFileCount, offset, size);
+
+		_offsetToResourceData += size;
+	}
 
 	// Write resource table entry
 	_stream.seek(_offsetToResourceTable);
@@ -76,13 +103,16 @@ void RIMWriter::add(const Common::UString &resRef, FileType resType, Common::Rea
 	_stream.writeUint16LE(resType);
 	_stream.writeZeros(2);
 	_stream.writeUint32LE(_currentFileCount);
-	_stream.writeUint32LE(_offsetToResourceData);
+	_stream.writeUint32LE(offset);
 	_stream.writeUint32LE(size);
 
-	_offsetToResourceData += size;
 	_offsetToResourceTable += 32;
 
 	_currentFileCount += 1;
 }
 
+uint64_t RIMWriter::getBytesSaved() const {
+	return _deduplicator ? _deduplicator->getBytesSaved() : 0;
+}
+
 } // End of namespace Aurora
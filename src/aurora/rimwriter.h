@@ -25,23 +25,33 @@
 #ifndef AURORA_RIMWRITER_H
 #define AURORA_RIMWRITER_H
 
+#include <memory>
+
 #include "src/common/writestream.h"
+#include "src/common/readstream.h"
 
 #include "src/aurora/types.h"
 
 namespace Aurora {
 
+class ResourceDeduplicator;
+
 class RIMWriter {
 public:
 	/** Create a new RIM writer.
 	 *
 	 *  @param fileCount the number of files to pack in this RIM file.
 	 *  @param stream the stream to write this RIM file to.
+	 *  @param deduplicate write the data of identical files only once.
 	 */
-	RIMWriter(uint32_t fileCount, Common::SeekableWriteStream &stream);
+	RIMWriter(uint32_t fileCount, Common::SeekableWriteStream &stream, bool deduplicate = false);
+	~RIMWriter();
 
 	/** Add a new stream to this archive to be packed. */
-	void add(const Common::UString &resRef, FileType resType, Common::ReadStream &stream);
+	void add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
+
+	/** Return the number of bytes not written, because they were duplicates. */
+	uint64_t getBytesSaved() const;
 
 private:
 	const uint32_t _fileCount;
@@ -51,6 +61,8 @@ private:
 	uint32_t _offsetToResourceData;
 
 	Common::SeekableWriteStream &_stream;
+
+	std::unique_ptr<ResourceDeduplicator> _deduplicator;
 };
 
 } // End of namespace Aurora
@@ -55,6 +55,7 @@ src_aurora_libaurora_la_SOURCES += \
     src/aurora/nitrofile.h \
     src/aurora/nsbtxfile.h \
     src/aurora/erfwriter.h \
+    src/aurora/erfupdater.h \
     src/aurora/sacfile.h \
     src/aurora/thewitchersavefile.h \
     src/aurora/thewitchersavewriter.h \
@@ -64,6 +65,7 @@ src_aurora_libaurora_la_SOURCES += \
     src/aurora/bifwriter.h \
     src/aurora/bzfwriter.h \
     src/aurora/rimwriter.h \
+    src/aurora/deduplicator.h \
     $(EMPTY)
 
 src_aurora_libaurora_la_SOURCES += \
@@ -74,6 +76,7 @@ src_aurora_libaurora_la_SOURCES += \
     src/aurora/erffile.cpp \
     src/aurora/rimfile.cpp \
     src/aurora/keyfile.cpp \
+    src/aurora/keydatafile.cpp \
     src/aurora/biffile.cpp \
     src/aurora/bzffile.cpp \
     src/aurora/ndsrom.cpp \
@@ -95,6 +98,7 @@ src_aurora_libaurora_la_SOURCES += \
     src/aurora/nitrofile.cpp \
     src/aurora/nsbtxfile.cpp \
     src/aurora/erfwriter.cpp \
+    src/aurora/erfupdater.cpp \
     src/aurora/sacfile.cpp \
     src/aurora/thewitchersavefile.cpp \
     src/aurora/thewitchersavewriter.cpp \
@@ -103,4 +107,5 @@ src_aurora_libaurora_la_SOURCES += \
     src/aurora/bifwriter.cpp \
     src/aurora/bzfwriter.cpp \
     src/aurora/rimwriter.cpp \
+    src/aurora/deduplicator.cpp \
     $(EMPTY)
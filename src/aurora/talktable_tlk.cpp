@@ -213,12 +213,12 @@ void TalkTable_TLK::setEntry(uint32_t strRef, const Common::UString &string, con
                              uint32_t soundID) {
 
 	if (strRef >= _entries.size()) {
+		/* All existing StrRefs are smaller than the number of entries, so the
+		 * StrRefs list stays sorted and unique without re-sorting it. This
+		 * keeps adding entries in ascending order fast. */
 		for (size_t i = _entries.size(); i < strRef; i++)
 			_strRefs.push_back(i);
 
-		_strRefs.sort();
-		_strRefs.unique();
-
 		_entries.resize(strRef + 1);
 	}
 
@@ -49,12 +49,9 @@ Common::SeekableReadStream *TheWitcherSaveFile::getResource(uint32_t index, bool
 	IResource resource = _resources[index];
 
 	if (tryNoCopy)
-		return new Common::SeekableSubReadStream(_tws.get(), resource.offset, resource.offset + resource.length);
-	else {
-		_tws->seek(resource.offset);
-		Common::SeekableReadStream *readStream = _tws->readStream(resource.length);
-		return readStream;
-	}
+		return _tws->getSubStream(resource.offset, resource.offset + resource.length);
+
+	return _tws->readStreamAt(resource.offset, resource.length);
 }
 
 void TheWitcherSaveFile::load() {
@@ -124,7 +121,7 @@ void TheWitcherSaveFile::load() {
 	}
 }
 
-uint32_t TheWitcherSaveFile::getResourceSize(uint32_t index) const {
+uint64_t TheWitcherSaveFile::getResourceSize(uint32_t index) const {
 	return _resources[index].length;
 }
 
@@ -49,7 +49,7 @@ public:
 	/** Return the list of resources. */
 	const ResourceList &getResources() const;
 
-	uint32_t getResourceSize(uint32_t index) const override;
+	uint64_t getResourceSize(uint32_t index) const override;
 
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
@@ -58,8 +58,8 @@ private:
 	void load();
 
 	struct IResource {
-		uint32_t offset;
-		uint32_t length;
+		uint64_t offset;
+		uint64_t length;
 	};
 
 	std::unique_ptr<Common::SeekableReadStream> _tws;
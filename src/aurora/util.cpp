@@ -25,6 +25,8 @@
 #include "src/common/util.h"
 #include "src/common/ustring.h"
 #include "src/common/filepath.h"
+#include "src/common/error.h"
+#include "src/common/readstream.h"
 
 #include "src/aurora/util.h"
 
@@ -561,4 +563,13 @@ Common::UString getPlatformDescription(Platform platform) {
 	return names[platform];
 }
 
+uint32_t readIndexCount(Common::SeekableReadStream &index, size_t minEntrySize) {
+	const uint32_t count = index.readUint32LE();
+
+	if ((index.size() - index.pos()) / minEntrySize < count)
+		throw Common::Exception("Index list size out of range (%u)", count);
+
+	return count;
+}
+
 } // End of namespace Aurora
@@ -33,11 +33,23 @@
 
 #include "src/aurora/types.h"
 
+namespace Common {
+	class SeekableReadStream;
+}
+
 namespace Aurora {
 
 /** Return the human readable string of a Platform. */
 Common::UString getPlatformDescription(Platform platform);
 
+/** Read the number of entries of a list in an index cache.
+ *
+ *  Throws if the rest of the index stream is too small to hold that many
+ *  entries of at least minEntrySize bytes each, so that a corrupt index
+ *  is detected before any memory is allocated for the list.
+ */
+uint32_t readIndexCount(Common::SeekableReadStream &index, size_t minEntrySize);
+
 
 class FileTypeManager : public Common::Singleton<FileTypeManager> {
 public:
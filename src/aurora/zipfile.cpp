@@ -47,7 +47,7 @@ const Archive::ResourceList &ZIPFile::getResources() const {
 	return _resources;
 }
 
-uint32_t ZIPFile::getResourceSize(uint32_t index) const {
+uint64_t ZIPFile::getResourceSize(uint32_t index) const {
 	return _zipFile->getFileSize(index);
 }
 
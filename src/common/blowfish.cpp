@@ -26,8 +26,11 @@
 
 #include <memory>
 
+#include <boost/noncopyable.hpp>
+
 #include "src/common/util.h"
 #include "src/common/error.h"
+#include "src/common/disposableptr.h"
 #include "src/common/memreadstream.h"
 #include "src/common/blowfish.h"
 
@@ -368,6 +371,122 @@ MemoryReadStream *blowfishEBC(SeekableReadStream &input, const std::vector<byte>
 	return new MemoryReadStream(output.release(), outputSize, true);
 }
 
+/** A stream decrypting its parent stream with Blowfish in EBC mode.
+ *
+ *  Since every block is decrypted on its own, only the blocks that are
+ *  actually read are decrypted. The last partially read block is kept,
+ *  so small sequential reads don't decrypt a block twice.
+ */
+class BlowfishDecryptReadStream : boost::noncopyable, public SeekableReadStream {
+public:
+	BlowfishDecryptReadStream(SeekableReadStream *input, const std::vector<byte> &key, bool disposeParentStream) :
+		_input(input, disposeParentStream), _ctx(std::make_unique<BlowfishContext>()),
+		_size(input->size()), _pos(0), _eos(false), _cachedBlock(kPositionInvalid) {
+
+		assert(_input);
+
+		if ((_size % kBlockSize) != 0)
+			throw Exception("Blowfish operates on blocks of 8 bytes (%u)", (uint) _size);
+
+		blowfishSetKey(*_ctx, &key[0], key.size());
+	}
+
+	bool eos() const {
+		return _eos;
+	}
+
+	size_t pos() const {
+		return _pos;
+	}
+
+	size_t size() const {
+		return _size;
+	}
+
+	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin) {
+		const size_t oldPos = _pos;
+		const size_t newPos = evalSeek(offset, whence, _pos, 0, _size);
+		if (newPos > _size)
+			throw Exception(kSeekError);
+
+		_pos = newPos;
+		_eos = false;
+
+		return oldPos;
+	}
+
+	size_t read(void *dataPtr, size_t dataSize) {
+		assert(dataPtr);
+
+		if (dataSize > (_size - _pos)) {
+			dataSize = _size - _pos;
+			_eos = true;
+		}
+
+		byte *data = reinterpret_cast<byte *>(dataPtr);
+
+		size_t left = dataSize;
+		while (left > 0) {
+			const size_t block  = _pos / kBlockSize;
+			const size_t offset = _pos % kBlockSize;
+
+			if ((offset == 0) && (left >= kBlockSize)) {
+				// Decrypt all whole blocks directly into the output buffer
+				const size_t count = left - (left % kBlockSize);
+
+				readBlocks(block, data, count);
+
+				data  += count;
+				_pos  += count;
+				left  -= count;
+				continue;
+			}
+
+			// Partially read a block through the cache
+			if (_cachedBlock != block) {
+				readBlocks(block, _cache, kBlockSize);
+				_cachedBlock = block;
+			}
+
+			const size_t count = MIN<size_t>(left, kBlockSize - offset);
+
+			std::memcpy(data, _cache + offset, count);
+
+			data  += count;
+			_pos  += count;
+			left  -= count;
+		}
+
+		return dataSize;
+	}
+
+private:
+	DisposablePtr<SeekableReadStream> _input;
+	std::unique_ptr<BlowfishContext> _ctx;
+
+	size_t _size;
+	size_t _pos;
+	bool _eos;
+
+	size_t _cachedBlock;
+	byte _cache[kBlockSize];
+
+	/** Read and decrypt size bytes of whole blocks, starting with block. */
+	void readBlocks(size_t block, byte *data, size_t size) {
+		assert((size % kBlockSize) == 0);
+
+		const size_t offset = block * kBlockSize;
+		if (_input->pos() != offset)
+			_input->seek(offset);
+
+		if (_input->read(data, size) != size)
+			throw Exception(kReadError);
+
+		for (size_t i = 0; i < size; i += kBlockSize)
+			blowfishECB(*_ctx, kModeDecrypt, data + i, data + i);
+	}
+};
+
 MemoryReadStream *encryptBlowfishEBC(SeekableReadStream &input, const std::vector<byte> &key) {
 	return blowfishEBC(input, key, kModeEncrypt);
 }
@@ -379,4 +498,12 @@ MemoryReadStream *decryptBlowfishEBC(SeekableReadStream &input, const std::vecto
 	return blowfishEBC(input, key, kModeDecrypt);
 }
 
+SeekableReadStream *createBlowfishDecryptStream(SeekableReadStream *input, const std::vector<byte> &key,
+                                                bool disposeParentStream) {
+
+	assert(input);
+
+	return new BlowfishDecryptReadStream(input, key, disposeParentStream);
+}
+
 } // End of namespace Common
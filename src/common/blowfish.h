@@ -39,6 +39,18 @@ MemoryReadStream *encryptBlowfishEBC(SeekableReadStream &input, const std::vecto
 /** Decrypt the stream with the Blowfish algorithm in EBC mode. */
 MemoryReadStream *decryptBlowfishEBC(SeekableReadStream &input, const std::vector<byte> &key);
 
+/** Return a stream decrypting the input with the Blowfish algorithm in EBC mode.
+ *
+ *  Unlike decryptBlowfishEBC(), the input is not decrypted all at once.
+ *  Instead, the returned stream only decrypts the blocks that are
+ *  actually read.
+ *
+ *  The input stream's size has to be a multiple of the block size of 8 bytes.
+ *  If disposeParentStream is true, the returned stream takes over the input stream.
+ */
+SeekableReadStream *createBlowfishDecryptStream(SeekableReadStream *input, const std::vector<byte> &key,
+                                                bool disposeParentStream = true);
+
 } // End of namespace Common
 
 #endif // COMMON_BLOWFISH_H
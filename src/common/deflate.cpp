@@ -22,6 +22,7 @@
  *  Compress (deflate) and decompress (inflate) using zlib's DEFLATE algorithm.
  */
 
+#include <cassert>
 #include <cstddef>
 
 #include <vector>
@@ -29,10 +30,13 @@
 
 #include <zlib.h>
 
+#include <boost/noncopyable.hpp>
 #include <boost/scope_exit.hpp>
 
 #include "src/common/deflate.h"
+#include "src/common/util.h"
 #include "src/common/error.h"
+#include "src/common/disposableptr.h"
 #include "src/common/memreadstream.h"
 
 namespace Common {
@@ -149,7 +153,7 @@ byte *decompressDeflateWithoutOutputSize(const byte *data, size_t inputSize, siz
 	std::unique_ptr<byte[]> decompressedData = std::make_unique<byte[]>(strm.total_out);
 	for (size_t i = 0; i < buffers.size(); ++i) {
 		if (i == buffers.size() - 1)
-			std::memcpy(decompressedData.get() + i * frameSize, buffers[i].get(), strm.total_out % frameSize);
+			std::memcpy(decompressedData.get() + i * frameSize, buffers[i].get(), strm.total_out - i * frameSize);
 		else
 			std::memcpy(decompressedData.get() + i * frameSize, buffers[i].get(), frameSize);
 	}
@@ -228,6 +232,84 @@ size_t decompressDeflateChunk(SeekableReadStream &input, int windowBits,
 	return strm.total_out;
 }
 
+/** A stream inflating its parent stream on the fly. */
+class InflateReadStream : boost::noncopyable, public ReadStream {
+public:
+	InflateReadStream(ReadStream *input, size_t inputSize, size_t outputSize, int windowBits,
+	                  bool disposeParentStream, unsigned int frameSize) :
+		_input(input, disposeParentStream), _inputSize(inputSize), _outputSize(outputSize),
+		_frame(std::make_unique<byte[]>(frameSize)), _frameSize(frameSize), _pos(0), _eos(false) {
+
+		assert(_input);
+
+		initInflateZStream(_strm, windowBits, 0, 0);
+	}
+
+	~InflateReadStream() {
+		inflateEnd(&_strm);
+	}
+
+	bool eos() const {
+		return _eos;
+	}
+
+	size_t read(void *dataPtr, size_t dataSize) {
+		assert(dataPtr);
+
+		if (dataSize > (_outputSize - _pos)) {
+			dataSize = _outputSize - _pos;
+			_eos = true;
+		}
+
+		_strm.next_out  = reinterpret_cast<byte *>(dataPtr);
+		_strm.avail_out = dataSize;
+
+		while (_strm.avail_out > 0) {
+			if ((_strm.avail_in == 0) && (_inputSize > 0)) {
+				const size_t frameSize = MIN<size_t>(_inputSize, _frameSize);
+				if (_input->read(_frame.get(), frameSize) != frameSize)
+					throw Exception(kReadError);
+
+				setZStreamInput(_strm, frameSize, _frame.get());
+				_inputSize -= frameSize;
+			}
+
+			const int zResult = inflate(&_strm, Z_SYNC_FLUSH);
+			if ((zResult == Z_STREAM_END) && (_strm.avail_out > 0))
+				throw Exception("Failed to inflate: output buffer not completely filled");
+
+			if ((zResult != Z_STREAM_END) && (zResult != Z_OK))
+				throw Exception("Failed to inflate: %s (%d)", zError(zResult), zResult);
+		}
+
+		_pos += dataSize;
+
+		return dataSize;
+	}
+
+private:
+	DisposablePtr<ReadStream> _input;
+
+	size_t _inputSize;  ///< Bytes of input left to read.
+	size_t _outputSize; ///< Total size of the decompressed data.
+
+	std::unique_ptr<byte[]> _frame;
+	unsigned int _frameSize;
+
+	size_t _pos;
+	bool _eos;
+
+	z_stream _strm;
+};
+
+ReadStream *decompressDeflateStream(ReadStream *input, size_t inputSize, size_t outputSize, int windowBits,
+                                    bool disposeParentStream, unsigned int frameSize) {
+
+	assert(input);
+
+	return new InflateReadStream(input, inputSize, outputSize, windowBits, disposeParentStream, frameSize);
+}
+
 byte *compressDeflate(const byte *data, size_t inputSize, size_t &outputSize, int windowBits, unsigned int frameSize) {
 	z_stream strm;
 	BOOST_SCOPE_EXIT( (&strm) ) {
@@ -250,12 +332,15 @@ byte *compressDeflate(const byte *data, size_t inputSize, size_t &outputSize, in
 		zResult = deflate(&strm, Z_FINISH);
 		if (zResult != Z_STREAM_END && zResult != Z_OK)
 			throw Exception("Failed to deflate: %s (%d)", zError(zResult), zResult);
-	} while (strm.avail_in != 0);
+
+		/* Even when all input has been consumed, the compressed output might
+		 * not yet have been completely written. Only Z_STREAM_END says so. */
+	} while (zResult != Z_STREAM_END);
 
 	std::unique_ptr<byte[]> compressedData = std::make_unique<byte[]>(strm.total_out);
 	for (size_t i = 0; i < buffers.size(); ++i) {
 		if (i == buffers.size() - 1)
-			std::memcpy(compressedData.get() + i * frameSize, buffers[i].get(), strm.total_out % frameSize);
+			std::memcpy(compressedData.get() + i * frameSize, buffers[i].get(), strm.total_out - i * frameSize);
 		else
 			std::memcpy(compressedData.get() + i * frameSize, buffers[i].get(), frameSize);
 	}
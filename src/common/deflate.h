@@ -117,6 +117,25 @@ SeekableReadStream *decompressDeflateWithoutOutputSize(ReadStream &input, size_t
 size_t decompressDeflateChunk(SeekableReadStream &input, int windowBits, byte *output, size_t outputSize,
                               unsigned int frameSize = 4096);
 
+/** Return a stream decompressing (inflating) the input on the fly, using zlib's DEFLATE algorithm.
+ *
+ *  Unlike decompressDeflate(), this doesn't decompress the whole data at
+ *  once. The returned stream can't seek, and it only ever keeps a frame of
+ *  the compressed input and zlib's history buffer in memory.
+ *
+ *  @param  input       The compressed input data.
+ *  @param  inputSize   The size of the input data to read in bytes.
+ *  @param  outputSize  The size of the decompressed output data.
+ *  @param  windowBits  The base two logarithm of the window size (the size of
+ *                      the history buffer). See the zlib documentation on
+ *                      inflateInit2() for details.
+ *  @param  disposeParentStream Should the input stream be deleted together with the returned stream?
+ *  @param  frameSize   The size of a frame for reading from the input stream.
+ *  @return A stream of the decompressed data.
+ */
+ReadStream *decompressDeflateStream(ReadStream *input, size_t inputSize, size_t outputSize, int windowBits,
+                                    bool disposeParentStream = true, unsigned int frameSize = 4096);
+
 /** Compress (deflate) using zlib's DEFLATE algorithm.
  *
  *  @param input      The input data to compress.
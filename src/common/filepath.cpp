@@ -41,8 +41,10 @@ using boost::filesystem::exists;
 using boost::filesystem::is_regular_file;
 using boost::filesystem::is_directory;
 using boost::filesystem::file_size;
+using boost::filesystem::last_write_time;
 using boost::filesystem::directory_iterator;
 using boost::filesystem::create_directories;
+using boost::filesystem::rename;
 
 // boost-string_algo
 using boost::equals;
@@ -79,6 +81,16 @@ size_t FilePath::getFileSize(const UString &p) {
 	return size;
 }
 
+uint64_t FilePath::getModificationTime(const UString &p) {
+	try {
+		return (uint64_t) last_write_time(p.c_str());
+	} catch (...) {
+	}
+
+	warning("Failed to get modification time of file \"%s\"", p.c_str());
+	return 0;
+}
+
 UString FilePath::getFile(const UString &p) {
 	path file(p.c_str());
 
@@ -349,6 +361,14 @@ bool FilePath::createDirectories(const UString &path) {
 	}
 }
 
+void FilePath::renameFile(const UString &oldPath, const UString &newPath) {
+	try {
+		rename(oldPath.c_str(), newPath.c_str());
+	} catch (std::exception &se) {
+		throw Exception(se);
+	}
+}
+
 UString FilePath::escapeStringLiteral(const UString &str) {
 	const std::regex esc("[\\^\\.\\$\\|\\(\\)\\[\\]\\*\\+\\?\\/\\\\]");
 	const std::string rep("\\$&");
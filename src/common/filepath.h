@@ -58,6 +58,13 @@ public:
 	 */
 	static size_t getFileSize(const UString &p);
 
+	/** Return a file's last modification time.
+	 *
+	 *  @param  p The file to look up.
+	 *  @return The modification time in seconds since the epoch, or 0 if not a valid file.
+	 */
+	static uint64_t getModificationTime(const UString &p);
+
 	/** Return a file name without its path.
 	 *
 	 *  Example: "/path/to/file.ext" > "file.ext"
@@ -201,6 +208,9 @@ public:
 	 */
 	static bool createDirectories(const UString &path);
 
+	/** Rename a file, replacing the file newPath if it already exists. */
+	static void renameFile(const UString &oldPath, const UString &newPath);
+
 	/** Escape a string literal for use in a regexp. */
 	static UString escapeStringLiteral(const UString &str);
 
@@ -26,11 +26,17 @@
 #include "src/common/types.h"
 #include <lzma.h>
 
+#include <cassert>
+#include <cstring>
+
 #include <memory>
+#include <vector>
 
+#include <boost/noncopyable.hpp>
 #include <boost/scope_exit.hpp>
 
 #include "src/common/lzma.h"
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
 #include "src/common/memwritestream.h"
@@ -64,7 +70,29 @@ static lzma_allocator kLZMAAllocator = {
 	&lzmaAlloc, &lzmaFree, 0
 };
 
-byte *decompressLZMA1(const byte *data, size_t inputSize, size_t outputSize, bool noEndMarker) {
+struct LZMA1Decoder::Stream {
+	lzma_stream strm;
+
+	Stream() {
+		const lzma_stream init = LZMA_STREAM_INIT;
+
+		strm = init;
+	}
+
+	~Stream() {
+		lzma_end(&strm);
+	}
+};
+
+LZMA1Decoder::LZMA1Decoder() : _stream(std::make_unique<Stream>()) {
+}
+
+LZMA1Decoder::~LZMA1Decoder() {
+}
+
+void LZMA1Decoder::decompress(const byte *data, size_t inputSize, byte *output, size_t outputSize,
+                              bool noEndMarker) {
+
 	lzma_filter filters[2] = {
 		{ LZMA_FILTER_LZMA1, 0 },
 		{ LZMA_VLI_UNKNOWN , 0 }
@@ -83,31 +111,30 @@ byte *decompressLZMA1(const byte *data, size_t inputSize, size_t outputSize, boo
 	if (lzma_properties_decode(&filters[0], &kLZMAAllocator, data, propsSize) != LZMA_OK)
 		throw Exception("Failed to decode LZMA1 properties");
 
+	BOOST_SCOPE_EXIT( (&filters) ) {
+		kLZMAAllocator.free(0, filters[0].options);
+	} BOOST_SCOPE_EXIT_END
+
 	data      += propsSize;
 	inputSize -= propsSize;
 
-	lzma_stream strm = LZMA_STREAM_INIT;
-	BOOST_SCOPE_EXIT( (&strm) (&filters) ) {
-		kLZMAAllocator.free(0, filters[0].options);
-		lzma_end(&strm);
-	} BOOST_SCOPE_EXIT_END
+	lzma_stream &strm = _stream->strm;
 
+	// Initializing the decoder again reuses the memory of the previous one, if possible
 	lzma_ret lzmaRet = LZMA_OK;
 
 	if ((lzmaRet = lzma_raw_decoder(&strm, filters)) != LZMA_OK)
 		throw Exception("Failed to create raw LZMA1 decoder: %d", (int) lzmaRet);
 
-	std::unique_ptr<byte[]> outputData = std::make_unique<byte[]>(outputSize);
-
 	strm.next_in   = data;
 	strm.avail_in  = inputSize;
-	strm.next_out  = outputData.get();
+	strm.next_out  = output;
 	strm.avail_out = outputSize;
 
 	lzmaRet = lzma_code(&strm, LZMA_FINISH);
 
 	if (noEndMarker && (lzmaRet == LZMA_OK) && (strm.avail_in == 0) && (strm.avail_out == 0))
-		return outputData.release();
+		return;
 
 	if ((lzmaRet != LZMA_STREAM_END) || (strm.avail_out != 0)) {
 		if (lzmaRet == LZMA_OK)
@@ -118,6 +145,13 @@ byte *decompressLZMA1(const byte *data, size_t inputSize, size_t outputSize, boo
 
 		throw Exception("Failed to uncompress LZMA1 data: %d", (int) lzmaRet);
 	}
+}
+
+byte *decompressLZMA1(const byte *data, size_t inputSize, size_t outputSize, bool noEndMarker) {
+	std::unique_ptr<byte[]> outputData = std::make_unique<byte[]>(outputSize);
+
+	LZMA1Decoder decoder;
+	decoder.decompress(data, inputSize, outputData.get(), outputSize, noEndMarker);
 
 	return outputData.release();
 }
@@ -226,6 +260,163 @@ std::unique_ptr<SeekableReadStream> decompressERFLZMA(ReadStream &input, size_t
 	return std::make_unique<MemoryReadStream>(std::move(outputData), outputSize);
 }
 
+/** A stream decompressing ERF LZMA data one chunk at a time. */
+class ERFLZMAReadStream : boost::noncopyable, public ReadStream {
+public:
+	ERFLZMAReadStream(std::unique_ptr<ReadStream> input, size_t inputSize, size_t outputSize) :
+		_input(std::move(input)), _outputSize(outputSize), _pos(0), _eos(false),
+		_nextChunk(0), _bufferPos(0), _decoded(0) {
+
+		_filters[0].id      = LZMA_FILTER_LZMA1;
+		_filters[0].options = 0;
+		_filters[1].id      = LZMA_VLI_UNKNOWN;
+		_filters[1].options = 0;
+
+		if (!lzma_filter_decoder_is_supported(_filters[0].id))
+			throw Exception("LZMA1 compression not supported");
+
+		uint32_t propsSize;
+		if (lzma_properties_size(&propsSize, &_filters[0]) != LZMA_OK)
+			throw Exception("Can't get LZMA1 properties size");
+
+		if (propsSize > inputSize)
+			throw Exception("LZMA1 properties size larger than input data");
+
+		{
+			// Read the properties
+			std::unique_ptr<byte[]> propertyData = std::make_unique<byte[]>(propsSize);
+			_input->readChecked(propertyData.get(), propsSize);
+			if (lzma_properties_decode(&_filters[0], &kLZMAAllocator, propertyData.get(), propsSize) != LZMA_OK)
+				throw Exception("Failed to decode LZMA1 properties");
+		}
+
+		try {
+			// Not sure what this byte is (possibly number of pages per decode?)
+			byte unk0 = _input->readByte();
+			if (unk0 != 0x10)
+				throw Exception("Unknown ERF LZMA header byte 0x%02X", unk0);
+
+			// Read in the chunk info
+			const uint32_t chunkCount = _input->readUint32LE();
+			_chunkSizes.reserve(chunkCount);
+			for (uint32_t i = 0; i < chunkCount; i++)
+				_chunkSizes.push_back(_input->readUint32LE());
+
+		} catch (...) {
+			kLZMAAllocator.free(0, _filters[0].options);
+			throw;
+		}
+	}
+
+	~ERFLZMAReadStream() {
+		kLZMAAllocator.free(0, _filters[0].options);
+	}
+
+	bool eos() const {
+		return _eos;
+	}
+
+	size_t read(void *dataPtr, size_t dataSize) {
+		assert(dataPtr);
+
+		if (dataSize > (_outputSize - _pos)) {
+			dataSize = _outputSize - _pos;
+			_eos = true;
+		}
+
+		byte *data = reinterpret_cast<byte *>(dataPtr);
+
+		size_t left = dataSize;
+		while (left > 0) {
+			if (_bufferPos == _buffer.size())
+				decompressChunk();
+
+			const size_t count = MIN<size_t>(left, _buffer.size() - _bufferPos);
+
+			std::memcpy(data, &_buffer[_bufferPos], count);
+
+			_bufferPos += count;
+			data       += count;
+			left       -= count;
+		}
+
+		_pos += dataSize;
+
+		return dataSize;
+	}
+
+private:
+	static const size_t kChunkSize = 0x10000;
+
+	std::unique_ptr<ReadStream> _input;
+
+	size_t _outputSize;
+	size_t _pos;
+	bool _eos;
+
+	lzma_filter _filters[2];
+
+	std::vector<uint32_t> _chunkSizes;
+	size_t _nextChunk;
+
+	std::vector<byte> _chunkData;
+
+	std::vector<byte> _buffer;
+	size_t _bufferPos;
+
+	size_t _decoded; ///< Number of bytes decompressed so far.
+
+	void decompressChunk() {
+		if (_nextChunk >= _chunkSizes.size())
+			throw Exception("Failed to fully decompress the ERF LZMA data");
+
+		const uint32_t chunkSize = _chunkSizes[_nextChunk++];
+
+		// Read the compressed chunk
+		_chunkData.resize(chunkSize);
+		if (chunkSize > 0)
+			_input->readChecked(&_chunkData[0], chunkSize);
+
+		// Allocate the stream
+		lzma_stream strm = LZMA_STREAM_INIT;
+		BOOST_SCOPE_EXIT((&strm)) {
+			lzma_end(&strm);
+		} BOOST_SCOPE_EXIT_END
+
+		// Create the raw decoder
+		lzma_ret lzmaRet = lzma_raw_decoder(&strm, _filters);
+		if (lzmaRet)
+			throw Exception("Failed to create raw LZMA1 decoder: %d", (int)lzmaRet);
+
+		// Like decompressERFLZMA(), clamp the decoded chunk to 0x10000 bytes
+		_buffer.resize(MIN<size_t>(_outputSize - _decoded, kChunkSize));
+		_bufferPos = 0;
+
+		strm.next_in   = _chunkData.empty() ? 0 : &_chunkData[0];
+		strm.avail_in  = chunkSize;
+		strm.next_out  = _buffer.empty() ? 0 : &_buffer[0];
+		strm.avail_out = _buffer.size();
+
+		// Read until we can't read anymore
+		lzmaRet = lzma_code(&strm, LZMA_FINISH);
+		if (lzmaRet != LZMA_OK)
+			throw Exception("Failed to uncompress ERF LZMA data: %d", (int)lzmaRet);
+
+		// Verify that we consumed the entire chunk
+		if (strm.avail_in != 0)
+			throw Exception("Found remaining ERF LZMA data: %u", (uint32_t)strm.avail_in);
+
+		_buffer.resize(strm.total_out);
+		_decoded += strm.total_out;
+	}
+};
+
+std::unique_ptr<ReadStream> decompressERFLZMAStream(std::unique_ptr<ReadStream> input,
+                                                    size_t inputSize, size_t outputSize) {
+
+	return std::make_unique<ERFLZMAReadStream>(std::move(input), inputSize, outputSize);
+}
+
 SeekableReadStream *compressLZMA1(ReadStream &input, size_t inputSize) {
 	lzma_options_lzma opt_lzma;
 	lzma_lzma_preset(&opt_lzma, LZMA_PRESET_DEFAULT);
@@ -267,6 +458,7 @@ SeekableReadStream *compressLZMA1(ReadStream &input, size_t inputSize) {
 	strm.avail_in = inputSize;
 	strm.next_in = data;
 
+	// Keep going until the encoder has flushed all its output, even after all input was consumed
 	byte outputData[4096];
 	do {
 		strm.avail_out = 4096;
@@ -275,12 +467,12 @@ SeekableReadStream *compressLZMA1(ReadStream &input, size_t inputSize) {
 		lzmaRet = lzma_code(&strm, LZMA_FINISH);
 
 		writeStream.write(outputData, 4096 - strm.avail_out);
-	} while (strm.avail_in != 0 && lzmaRet != LZMA_OK);
+	} while (lzmaRet == LZMA_OK);
 
 	delete[] data;
 
-	if (lzmaRet == LZMA_OK)
-		throw Exception("Failed to compress LZMA1 data: premature end of output buffer");
+	if (lzmaRet != LZMA_STREAM_END)
+		throw Exception("Failed to compress LZMA1 data: %d", (int) lzmaRet);
 
 	if (strm.avail_in != 0)
 		throw Exception("Failed to compress LZMA1 data: input buffer not completely used");
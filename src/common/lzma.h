@@ -27,6 +27,8 @@
 
 #include <memory>
 
+#include <boost/noncopyable.hpp>
+
 #include "src/common/types.h"
 
 namespace Common {
@@ -34,6 +36,37 @@ namespace Common {
 class ReadStream;
 class SeekableReadStream;
 
+/** A reusable LZMA1 decoder.
+ *
+ *  Decompressing many small LZMA1 streams one after another with the same
+ *  decoder lets liblzma keep its decoder state and dictionary allocated,
+ *  instead of setting them up anew for every stream.
+ *
+ *  A decoder may only be used by one thread at a time.
+ */
+class LZMA1Decoder : boost::noncopyable {
+public:
+	LZMA1Decoder();
+	~LZMA1Decoder();
+
+	/** Decompress LZMA1 data, starting with its properties, into a buffer.
+	 *
+	 *  @param data        The compressed input data.
+	 *  @param inputSize   The size of the input data in bytes.
+	 *  @param output      The buffer to decompress into.
+	 *  @param outputSize  The size of the decompressed data, which has to fill
+	 *                     the output buffer completely.
+	 *  @param noEndMarker The compressed stream has no end marker.
+	 */
+	void decompress(const byte *data, size_t inputSize, byte *output, size_t outputSize,
+	                bool noEndMarker = false);
+
+private:
+	struct Stream;
+
+	std::unique_ptr<Stream> _stream;
+};
+
 /** Decompress using the LZMA1 algorithm.
  *
  *  @param  data       The compressed input data.
@@ -72,6 +105,21 @@ SeekableReadStream *decompressLZMA1(ReadStream &input, size_t inputSize, size_t
  */
 std::unique_ptr<SeekableReadStream> decompressERFLZMA(ReadStream &input, size_t inputSize, size_t outputSize);
 
+/** Return a stream decompressing the ERF LZMA algorithm on the fly.
+ *
+ *  Unlike decompressERFLZMA(), this doesn't decompress the whole data
+ *  at once. The ERF LZMA data consists of individually compressed chunks
+ *  of 64KB each, and the returned stream only decompresses one chunk at
+ *  a time. It can't seek.
+ *
+ *  @param  input      The compressed input data.
+ *  @param  inputSize  The size of the input data to read in bytes.
+ *  @param  outputSize The size of the decompressed output data.
+ *  @return A stream of the decompressed data.
+ */
+std::unique_ptr<ReadStream> decompressERFLZMAStream(std::unique_ptr<ReadStream> input,
+                                                    size_t inputSize, size_t outputSize);
+
 /**
  * Compress using the LZMA1 algorithm.
  *
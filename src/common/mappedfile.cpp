@@ -0,0 +1,182 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Implementing the stream reading interfaces for memory-mapped files.
+ */
+
+#include <cassert>
+#include <cstring>
+
+#include <memory>
+
+#include "src/common/mappedfile.h"
+#include "src/common/readfile.h"
+#include "src/common/memreadstream.h"
+#include "src/common/error.h"
+#include "src/common/ustring.h"
+#include "src/common/platform.h"
+
+namespace Common {
+
+MappedFile::MappedFile() : _data(0), _size(kSizeInvalid), _pos(0), _eos(false) {
+}
+
+MappedFile::MappedFile(const UString &fileName) : _data(0), _size(kSizeInvalid), _pos(0), _eos(false) {
+	if (!open(fileName))
+		throw Exception("Can't open file \"%s\"", fileName.c_str());
+}
+
+MappedFile::~MappedFile() {
+	close();
+}
+
+bool MappedFile::open(const UString &fileName) {
+	close();
+
+	size_t size = 0;
+	if ((_data = Platform::mapFile(fileName, size))) {
+		_size = size;
+
+		return true;
+	}
+
+	/* Can't map the file, so read it as a normal file instead. Reading the
+	 * whole file into memory would need too much memory for big archives. */
+
+	std::unique_ptr<ReadFile> file = std::make_unique<ReadFile>();
+	if (!file->open(fileName))
+		return false;
+
+	_size = file->size();
+	_file = std::move(file);
+
+	return true;
+}
+
+void MappedFile::close() {
+	if (_data)
+		Platform::unmapFile(_data, _size);
+
+	_file.reset();
+
+	_data = 0;
+	_size = kSizeInvalid;
+	_pos  = 0;
+	_eos  = false;
+}
+
+bool MappedFile::isOpen() const {
+	return _data || _file;
+}
+
+bool MappedFile::eos() const {
+	if (_file)
+		return _file->eos();
+
+	if (!_data)
+		return true;
+
+	return _eos;
+}
+
+size_t MappedFile::pos() const {
+	if (_file)
+		return _file->pos();
+
+	if (!_data)
+		return kPositionInvalid;
+
+	return _pos;
+}
+
+size_t MappedFile::size() const {
+	return _size;
+}
+
+size_t MappedFile::seek(ptrdiff_t offset, Origin whence) {
+	if (_file)
+		return _file->seek(offset, whence);
+
+	if (!_data)
+		throw Exception(kSeekError);
+
+	const size_t oldPos = _pos;
+	const size_t newPos = evalSeek(offset, whence, _pos, 0, _size);
+	if (newPos > _size)
+		throw Exception(kSeekError);
+
+	_pos = newPos;
+	_eos = false;
+
+	return oldPos;
+}
+
+size_t MappedFile::read(void *dataPtr, size_t dataSize) {
+	if (_file)
+		return _file->read(dataPtr, dataSize);
+
+	if (!_data)
+		return 0;
+
+	assert(dataPtr);
+
+	if (dataSize > (_size - _pos)) {
+		dataSize = _size - _pos;
+		_eos = true;
+	}
+
+	std::memcpy(dataPtr, _data + _pos, dataSize);
+	_pos += dataSize;
+
+	return dataSize;
+}
+
+size_t MappedFile::readAt(size_t offset, void *dataPtr, size_t dataSize) {
+	if (_file)
+		return _file->readAt(offset, dataPtr, dataSize);
+
+	if (!_data || (offset > _size))
+		throw Exception(kSeekError);
+
+	assert(dataPtr);
+
+	dataSize = MIN(dataSize, _size - offset);
+	std::memcpy(dataPtr, _data + offset, dataSize);
+
+	return dataSize;
+}
+
+SeekableReadStream *MappedFile::getSubStream(size_t begin, size_t end) {
+	if (!isOpen() || (begin > end) || (end > _size))
+		throw Exception(kSeekError);
+
+	// Without a mapping, the sub stream reads the file through our readAt()
+	if (_file)
+		return new PositionalSubReadStream(this, begin, end);
+
+	return new MemoryReadStream(_data + begin, end - begin);
+}
+
+const byte *MappedFile::getData() const {
+	return _data;
+}
+
+} // End of namespace Common
@@ -0,0 +1,107 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Implementing the stream reading interfaces for memory-mapped files.
+ */
+
+#ifndef COMMON_MAPPEDFILE_H
+#define COMMON_MAPPEDFILE_H
+
+#include <cstddef>
+
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/readstream.h"
+
+namespace Common {
+
+class UString;
+class ReadFile;
+
+/** A file mapped read-only into memory.
+ *
+ *  Reading from a MappedFile does not need any system calls, and
+ *  getSubStream() returns streams viewing the mapped memory directly,
+ *  without copying. These views are independent of each other and of
+ *  the MappedFile's position, so they can be read from several threads
+ *  at once.
+ *
+ *  If the platform can't map the file, it is read through a ReadFile
+ *  instead, using positional reads for readAt() and getSubStream().
+ */
+class MappedFile : boost::noncopyable, public SeekableReadStream {
+public:
+	MappedFile();
+	MappedFile(const UString &fileName);
+	~MappedFile();
+
+	/** Try to map the file with the given fileName.
+	 *
+	 *  @param  fileName the name of the file to map
+	 *  @return true if file was mapped successfully, false otherwise
+	 */
+	bool open(const UString &fileName);
+
+	/** Unmap the file, if mapped. */
+	void close();
+
+	/** Checks if the object mapped a file successfully.
+	 *
+	 *  @return true if any file is mapped, false otherwise.
+	 */
+	bool isOpen() const;
+
+	bool eos() const;
+
+	size_t pos() const;
+	size_t size() const;
+
+	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin);
+	size_t read(void *dataPtr, size_t dataSize);
+
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize);
+
+	/** Return a stream of the range [begin, end) of the file.
+	 *
+	 *  For a mapped file, this is a MemoryReadStream viewing the mapped memory.
+	 */
+	SeekableReadStream *getSubStream(size_t begin, size_t end);
+
+	/** Return the whole mapped file data, or 0 if the file couldn't be mapped. */
+	const byte *getData() const;
+
+private:
+	const byte *_data; ///< The mapped file data.
+	size_t _size;      ///< The file's size.
+	size_t _pos;       ///< The current position within the file.
+
+	bool _eos; ///< Has a read hit the end of the file?
+
+	/** The file read normally, if it couldn't be mapped. */
+	std::unique_ptr<ReadFile> _file;
+};
+
+} // End of namespace Common
+
+#endif // COMMON_MAPPEDFILE_H
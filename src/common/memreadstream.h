@@ -107,6 +107,11 @@ public:
 
 	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin);
 
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize);
+
+	/** Return a MemoryReadStream viewing the range [begin, end) of our memory. */
+	SeekableReadStream *getSubStream(size_t begin, size_t end);
+
 	const byte *getData() const;
 
 private:
@@ -29,14 +29,20 @@
 	#include <windows.h>
 	#include <shellapi.h>
 	#include <wchar.h>
+	#include <io.h>
+	#include <fcntl.h>
 #endif
 
 #if defined(UNIX)
 	#include <pwd.h>
 	#include <unistd.h>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <sys/mman.h>
 #endif
 
 #include <cassert>
+#include <cerrno>
 #include <cstdlib>
 
 #include <memory>
@@ -106,11 +112,11 @@ std::FILE *Platform::openFile(const UString &fileName, FileMode mode) {
 	std::FILE *file = 0;
 
 #if defined(WIN32)
-	static const wchar_t * const modeStrings[kFileModeMAX] = { L"rb", L"wb" };
+	static const wchar_t * const modeStrings[kFileModeMAX] = { L"rb", L"wb", L"r+b" };
 
 	file = _wfopen(boost::filesystem::path(fileName.c_str()).c_str(), modeStrings[(uint) mode]);
 #else
-	static const char * const modeStrings[kFileModeMAX] = { "rb", "wb" };
+	static const char * const modeStrings[kFileModeMAX] = { "rb", "wb", "r+b" };
 
 	file = std::fopen(boost::filesystem::path(fileName.c_str()).c_str(), modeStrings[(uint) mode]);
 #endif
@@ -119,6 +125,159 @@ std::FILE *Platform::openFile(const UString &fileName, FileMode mode) {
 }
 // '--- openFile() ---'
 
+// .--- mapFile() ---.
+/** Stand-in for the data of empty files, which can't be mapped. */
+static const byte kEmptyFileData = 0;
+
+#if defined(WIN32)
+
+const byte *Platform::mapFile(const UString &fileName, size_t &size) {
+	HANDLE file = CreateFileW(boost::filesystem::path(fileName.c_str()).c_str(), GENERIC_READ,
+	                          FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (file == INVALID_HANDLE_VALUE)
+		return 0;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || ((uint64_t)fileSize.QuadPart > (uint64_t)SIZE_MAX)) {
+		CloseHandle(file);
+		return 0;
+	}
+
+	size = (size_t)fileSize.QuadPart;
+	if (size == 0) {
+		CloseHandle(file);
+		return &kEmptyFileData;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, 0, PAGE_READONLY, 0, 0, 0);
+	CloseHandle(file);
+
+	if (!mapping)
+		return 0;
+
+	// The view keeps the mapping alive after its handle is closed
+	const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+
+	return reinterpret_cast<const byte *>(data);
+}
+
+void Platform::unmapFile(const byte *data, size_t size) {
+	if (!data || (size == 0))
+		return;
+
+	UnmapViewOfFile(data);
+}
+
+#elif defined(UNIX)
+
+const byte *Platform::mapFile(const UString &fileName, size_t &size) {
+	const int fd = ::open(boost::filesystem::path(fileName.c_str()).c_str(), O_RDONLY);
+	if (fd < 0)
+		return 0;
+
+	struct stat fileStat;
+	if ((fstat(fd, &fileStat) != 0) || !S_ISREG(fileStat.st_mode) ||
+	    ((uint64_t)fileStat.st_size > (uint64_t)SIZE_MAX)) {
+
+		::close(fd);
+		return 0;
+	}
+
+	size = (size_t)fileStat.st_size;
+	if (size == 0) {
+		::close(fd);
+		return &kEmptyFileData;
+	}
+
+	// The mapping stays valid after the file descriptor is closed
+	void *data = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+
+	if (data == MAP_FAILED)
+		return 0;
+
+	return reinterpret_cast<const byte *>(data);
+}
+
+void Platform::unmapFile(const byte *data, size_t size) {
+	if (!data || (size == 0))
+		return;
+
+	munmap(const_cast<byte *>(data), size);
+}
+
+#else
+
+const byte *Platform::mapFile(const UString &UNUSED(fileName), size_t &UNUSED(size)) {
+	return 0;
+}
+
+void Platform::unmapFile(const byte *UNUSED(data), size_t UNUSED(size)) {
+}
+
+#endif
+// '--- mapFile() ---'
+
+// .--- readFileAt() ---.
+#if defined(UNIX)
+
+bool Platform::readFileAt(std::FILE *file, size_t offset, void *data, size_t size, size_t &bytesRead) {
+	const int fd = fileno(file);
+	if (fd < 0)
+		return false;
+
+	byte *buffer = reinterpret_cast<byte *>(data);
+
+	bytesRead = 0;
+	while (bytesRead < size) {
+		const ssize_t n = pread(fd, buffer + bytesRead, size - bytesRead, (off_t)(offset + bytesRead));
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+
+			break;
+		}
+
+		if (n == 0)
+			break;
+
+		bytesRead += (size_t)n;
+	}
+
+	return true;
+}
+
+#else
+
+/* On Windows, ReadFile() with an OVERLAPPED offset still moves the file pointer
+ * of a synchronous handle, which would confuse the C stdio buffering. */
+bool Platform::readFileAt(std::FILE *UNUSED(file), size_t UNUSED(offset), void *UNUSED(data),
+                          size_t UNUSED(size), size_t &UNUSED(bytesRead)) {
+	return false;
+}
+
+#endif
+// '--- readFileAt() ---'
+
+// .--- setStdOutBinary() ---.
+#if defined(WIN32)
+
+void Platform::setStdOutBinary() {
+	std::fflush(stdout);
+
+	_setmode(_fileno(stdout), _O_BINARY);
+}
+
+#else
+
+/* Other platforms don't distinguish between text and binary mode. */
+void Platform::setStdOutBinary() {
+}
+
+#endif
+// '--- setStdOutBinary() ---'
+
 // .--- Windows utility functions ---.
 #if defined(WIN32)
 
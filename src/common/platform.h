@@ -29,6 +29,7 @@
 
 #include <vector>
 
+#include "src/common/types.h"
 #include "src/common/ustring.h"
 
 namespace Common {
@@ -38,6 +39,7 @@ public:
 	enum FileMode {
 		kFileModeRead = 0,
 		kFileModeWrite   ,
+		kFileModeUpdate  , ///< Read and write an existing file, without truncating it.
 
 		kFileModeMAX
 	};
@@ -51,6 +53,33 @@ public:
 	/** Open a file with an UTF-8 encoded name. */
 	static std::FILE *openFile(const UString &fileName, FileMode mode);
 
+	/** Map a file with an UTF-8 encoded name read-only into memory.
+	 *
+	 *  @param  fileName The name of the file to map.
+	 *  @param  size The size of the mapped file is stored here.
+	 *  @return The mapped file data, or 0 if the file could not be mapped.
+	 */
+	static const byte *mapFile(const UString &fileName, size_t &size);
+	/** Unmap a file previously mapped with mapFile(). */
+	static void unmapFile(const byte *data, size_t size);
+
+	/** Read from the given position of a file opened with openFile(), without
+	 *  using or moving the file position. Can be called by several threads at
+	 *  the same time.
+	 *
+	 *  @param  file The file to read from.
+	 *  @param  offset The position within the file to read from.
+	 *  @param  data The buffer to read into.
+	 *  @param  size The number of bytes to read.
+	 *  @param  bytesRead The number of bytes actually read is stored here.
+	 *  @return false if the platform doesn't support positional reads.
+	 */
+	static bool readFileAt(std::FILE *file, size_t offset, void *data, size_t size, size_t &bytesRead);
+
+	/** Switch stdout into binary mode, so that binary data written to it
+	 *  isn't mangled by line ending conversions. */
+	static void setStdOutBinary();
+
 	/** Return the OS-specific path of the user's home directory. */
 	static UString getHomeDirectory();
 	/** Return the OS-specific path of the config directory. */
@@ -139,6 +139,21 @@ size_t ReadFile::read(void *dataPtr, size_t dataSize) {
 	return std::fread(dataPtr, 1, dataSize, _handle);
 }
 
+size_t ReadFile::readAt(size_t offset, void *dataPtr, size_t dataSize) {
+	if (!_handle || (offset > _size))
+		throw Exception(kSeekError);
+
+	assert(dataPtr);
+
+	dataSize = MIN(dataSize, _size - offset);
+
+	size_t bytesRead = 0;
+	if (Platform::readFileAt(_handle, offset, dataPtr, dataSize, bytesRead))
+		return bytesRead;
+
+	return SeekableReadStream::readAt(offset, dataPtr, dataSize);
+}
+
 MemoryReadStream *ReadFile::readIntoMemory(const UString &fileName) {
 	ReadFile file(fileName);
 
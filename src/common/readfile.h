@@ -69,6 +69,13 @@ public:
 	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin);
 	size_t read(void *dataPtr, size_t dataSize);
 
+	/** Read data from the given position of the file, without moving the file position.
+	 *
+	 *  Where the platform supports positional reads, this reads the file directly,
+	 *  and any number of threads can read from the same file at the same time.
+	 */
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize);
+
 	/** Read the whole file into memory and return a stream of its contents. */
 	static MemoryReadStream *readIntoMemory(const UString &fileName);
 
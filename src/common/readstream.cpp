@@ -50,6 +50,7 @@
 #include <cassert>
 
 #include <memory>
+#include <mutex>
 
 #include "src/common/readstream.h"
 #include "src/common/memreadstream.h"
@@ -81,6 +82,41 @@ SeekableReadStream::SeekableReadStream() {
 SeekableReadStream::~SeekableReadStream() {
 }
 
+/** Serializes the seeking and reading of the default readAt() implementation.
+ *
+ *  This needs to be recursive, because the read() of a stream might itself
+ *  call the default readAt() of its parent stream.
+ */
+static std::recursive_mutex readAtMutex;
+
+size_t SeekableReadStream::readAt(size_t offset, void *dataPtr, size_t dataSize) {
+	std::lock_guard<std::recursive_mutex> lock(readAtMutex);
+
+	if (offset > size())
+		throw Exception(kSeekError);
+
+	const size_t oldPos = seek(offset);
+
+	const size_t bytesRead = read(dataPtr, dataSize);
+
+	seek(oldPos);
+
+	return bytesRead;
+}
+
+MemoryReadStream *SeekableReadStream::readStreamAt(size_t offset, size_t dataSize) {
+	std::unique_ptr<byte[]> buf = std::make_unique<byte[]>(dataSize);
+
+	if (readAt(offset, buf.get(), dataSize) != dataSize)
+		throw Exception(kReadError);
+
+	return new MemoryReadStream(buf.release(), dataSize, true);
+}
+
+SeekableReadStream *SeekableReadStream::getSubStream(size_t begin, size_t end) {
+	return new PositionalSubReadStream(this, begin, end);
+}
+
 size_t SeekableReadStream::evalSeek(ptrdiff_t offset, Origin whence, size_t pos, size_t begin, size_t size) {
 	switch (whence) {
 		case kOriginEnd:
@@ -163,6 +199,79 @@ size_t SeekableSubReadStream::seek(ptrdiff_t offset, Origin whence) {
 	return oldPos;
 }
 
+size_t SeekableSubReadStream::readAt(size_t offset, void *dataPtr, size_t dataSize) {
+	if (offset > size())
+		throw Exception(kSeekError);
+
+	dataSize = MIN(dataSize, size() - offset);
+
+	return _parentStream->readAt(_begin + offset, dataPtr, dataSize);
+}
+
+
+PositionalSubReadStream::PositionalSubReadStream(SeekableReadStream *parentStream, size_t begin,
+                                                 size_t end, bool disposeParentStream) :
+	_parentStream(parentStream, disposeParentStream), _begin(begin), _end(end), _pos(begin), _eos(false) {
+
+	assert(parentStream);
+
+	if ((_begin > _end) || (_end > _parentStream->size()))
+		throw Exception(kSeekError);
+}
+
+PositionalSubReadStream::~PositionalSubReadStream() {
+}
+
+bool PositionalSubReadStream::eos() const {
+	return _eos;
+}
+
+size_t PositionalSubReadStream::pos() const {
+	return _pos - _begin;
+}
+
+size_t PositionalSubReadStream::size() const {
+	return _end - _begin;
+}
+
+size_t PositionalSubReadStream::seek(ptrdiff_t offset, Origin whence) {
+	const size_t oldPos = _pos - _begin;
+	const size_t newPos = evalSeek(offset, whence, _pos, _begin, size());
+	if ((newPos < _begin) || (newPos > _end))
+		throw Exception(kSeekError);
+
+	_pos = newPos;
+	_eos = false; // reset eos on successful seek
+
+	return oldPos;
+}
+
+size_t PositionalSubReadStream::read(void *dataPtr, size_t dataSize) {
+	assert(dataPtr);
+
+	if (dataSize > (_end - _pos)) {
+		dataSize = _end - _pos;
+		_eos = true;
+	}
+
+	const size_t bytesRead = _parentStream->readAt(_pos, dataPtr, dataSize);
+	if (bytesRead != dataSize)
+		_eos = true;
+
+	_pos += bytesRead;
+
+	return bytesRead;
+}
+
+size_t PositionalSubReadStream::readAt(size_t offset, void *dataPtr, size_t dataSize) {
+	if (offset > size())
+		throw Exception(kSeekError);
+
+	dataSize = MIN(dataSize, size() - offset);
+
+	return _parentStream->readAt(_begin + offset, dataPtr, dataSize);
+}
+
 
 SeekableSubReadStreamEndian::SeekableSubReadStreamEndian(SeekableReadStream *parentStream,
 		size_t begin, size_t end, bool bigEndian, bool disposeParentStream) :
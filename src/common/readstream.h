@@ -52,6 +52,8 @@
 
 #include <cstddef>
 
+#include <boost/noncopyable.hpp>
+
 #include "src/common/types.h"
 #include "src/common/endianness.h"
 #include "src/common/disposableptr.h"
@@ -316,6 +318,47 @@ public:
 		return seek(offset, kOriginCurrent);
 	}
 
+	/** Read data from the given position of the stream, without using or
+	 *  changing the stream position indicator. Similar to POSIX pread().
+	 *
+	 *  Files and streams that keep all their data in memory implement this
+	 *  directly, so that any number of threads can call readAt() on the same
+	 *  stream at the same time. By default, this seeks, reads and seeks back
+	 *  while holding a lock, which is only safe against concurrent readAt()
+	 *  calls, not against concurrent read() or seek() calls.
+	 *
+	 *  When the offset lies outside the stream, a kSeekError exception is thrown.
+	 *
+	 *  @param  offset the position within the stream to read from.
+	 *  @param  dataPtr pointer to a buffer into which the data is read.
+	 *  @param  dataSize number of bytes to be read.
+	 *  @return the number of bytes which were actually read.
+	 */
+	virtual size_t readAt(size_t offset, void *dataPtr, size_t dataSize);
+
+	/** Read the specified amount of data from the given position into a new[]'ed
+	 *  buffer which then is wrapped into a MemoryReadStream, using readAt().
+	 *
+	 *  When reading fails, a kReadError exception is thrown.
+	 */
+	MemoryReadStream *readStreamAt(size_t offset, size_t dataSize);
+
+	/** Create a stream of the range [begin, end) of this stream, without copying
+	 *  the data.
+	 *
+	 *  By default, this is a PositionalSubReadStream, which reads this stream
+	 *  with readAt() and doesn't move its position. Streams that keep all their
+	 *  data in memory instead return a MemoryReadStream directly viewing that memory.
+	 *
+	 *  Either way, the returned stream is independent of the position of this
+	 *  stream and of other sub streams, but only valid as long as this stream exists.
+	 *
+	 *  @param  begin The position within this stream the new stream starts at.
+	 *  @param  end The position within this stream the new stream ends at.
+	 *  @return A new stream of the range [begin, end).
+	 */
+	virtual SeekableReadStream *getSubStream(size_t begin, size_t end);
+
 	/** Evaluate the seek offset relative to whence into a position from the beginning. */
 	static size_t evalSeek(ptrdiff_t offset, Origin whence, size_t pos, size_t begin, size_t size);
 };
@@ -365,6 +408,8 @@ public:
 
 	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin);
 
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize);
+
 protected:
 	SeekableReadStream *_parentStream;
 
@@ -372,6 +417,41 @@ protected:
 };
 
 
+/** PositionalSubReadStream provides access to a SeekableReadStream restricted
+ *  to the range [begin, end), reading the parent stream with readAt().
+ *
+ *  Unlike SeekableSubReadStream, it keeps its own position and never moves
+ *  the position of the parent stream. Several PositionalSubReadStreams of
+ *  the same parent stream can be read at the same time, even from different
+ *  threads, as long as nothing else moves the parent stream in the meantime.
+ */
+class PositionalSubReadStream : boost::noncopyable, public SeekableReadStream {
+public:
+	PositionalSubReadStream(SeekableReadStream *parentStream, size_t begin, size_t end,
+	                        bool disposeParentStream = false);
+	~PositionalSubReadStream();
+
+	bool eos() const;
+
+	size_t pos() const;
+	size_t size() const;
+
+	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin);
+	size_t read(void *dataPtr, size_t dataSize);
+
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize);
+
+private:
+	DisposablePtr<SeekableReadStream> _parentStream;
+
+	size_t _begin;
+	size_t _end;
+	size_t _pos;
+
+	bool _eos;
+};
+
+
 /** This is a wrapper around SeekableSubReadStream, but it adds non-endian
  *  read methods whose endianness is set on the stream creation.
  *
@@ -52,6 +52,7 @@ src_common_libcommon_la_SOURCES += \
     src/common/stdoutstream.h \
     src/common/streamtokenizer.h \
     src/common/readfile.h \
+    src/common/mappedfile.h \
     src/common/writefile.h \
     src/common/filepath.h \
     src/common/zipfile.h \
@@ -60,6 +61,8 @@ src_common_libcommon_la_SOURCES += \
     src/common/stringmap.h \
     src/common/string.h \
     src/common/lzx.h \
+    src/common/threadpool.h \
+    src/common/tarwriter.h \
     $(EMPTY)
 
 src_common_libcommon_la_SOURCES += \
@@ -83,6 +86,7 @@ src_common_libcommon_la_SOURCES += \
     src/common/stdoutstream.cpp \
     src/common/streamtokenizer.cpp \
     src/common/readfile.cpp \
+    src/common/mappedfile.cpp \
     src/common/writefile.cpp \
     src/common/filepath.cpp \
     src/common/zipfile.cpp \
@@ -90,6 +94,8 @@ src_common_libcommon_la_SOURCES += \
     src/common/stringmap.cpp \
     src/common/string.cpp \
     src/common/lzx.cpp \
+    src/common/threadpool.cpp \
+    src/common/tarwriter.cpp \
     $(EMPTY)
 
 src_common_libcommon_la_LIBADD = \
@@ -0,0 +1,188 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Writing tar archives.
+ */
+
+#include <cstring>
+#include <cstdio>
+
+#include <memory>
+
+#include "src/common/tarwriter.h"
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/readstream.h"
+#include "src/common/writestream.h"
+
+namespace Common {
+
+static const size_t kBlockSize = 512;
+
+/** The amount of file data copied at once. */
+static const size_t kCopyBufferSize = 64 * 1024;
+
+/** Write a value as a NUL-terminated octal number into a header field. */
+static bool writeOctal(char *field, size_t fieldSize, uint64_t value) {
+	char buffer[32];
+	const int length = std::snprintf(buffer, sizeof(buffer), "%0*llo",
+	                                 static_cast<int>(fieldSize - 1), static_cast<unsigned long long>(value));
+
+	if ((length < 0) || (static_cast<size_t>(length) >= fieldSize))
+		return false;
+
+	std::memcpy(field, buffer, length + 1);
+	return true;
+}
+
+/** Write a value into a header field using the GNU base-256 encoding. */
+static void writeBase256(char *field, size_t fieldSize, uint64_t value) {
+	std::memset(field, 0, fieldSize);
+
+	for (size_t i = fieldSize - 1; (i > 0) && (value != 0); i--, value >>= 8)
+		field[i] = static_cast<char>(value & 0xFF);
+
+	field[0] = static_cast<char>(0x80);
+}
+
+TarWriter::TarWriter(WriteStream &stream) : _stream(&stream), _time(std::time(0)), _finished(false) {
+}
+
+TarWriter::~TarWriter() {
+}
+
+void TarWriter::add(const UString &fileName, ReadStream &data, uint64_t size) {
+	if (_finished)
+		throw Exception("Tar archive already finished");
+
+	writeHeader(fileName, size);
+
+	std::unique_ptr<byte[]> buffer = std::make_unique<byte[]>(kCopyBufferSize);
+
+	uint64_t left = size;
+	try {
+		while (left > 0) {
+			const size_t toRead = static_cast<size_t>(MIN<uint64_t>(left, kCopyBufferSize));
+			const size_t bytesRead = data.read(buffer.get(), toRead);
+
+			_stream->writeChecked(buffer.get(), bytesRead);
+			left -= bytesRead;
+
+			if (bytesRead != toRead)
+				break;
+		}
+
+	} catch (...) {
+		// Reading failed halfway, but the header is already written. Keep the archive intact
+		writePadding(size, left);
+		throw;
+	}
+
+	writePadding(size, left);
+
+	if (left > 0)
+		throw Exception(kReadError);
+}
+
+void TarWriter::writePadding(uint64_t size, uint64_t left) {
+	// Pad a truncated file, so that the following files are still found
+	for (uint64_t i = 0; i < left; i += kCopyBufferSize)
+		_stream->writeZeros(static_cast<size_t>(MIN<uint64_t>(left - i, kCopyBufferSize)));
+
+	_stream->writeZeros((kBlockSize - (size % kBlockSize)) % kBlockSize);
+}
+
+void TarWriter::finish() {
+	if (_finished)
+		return;
+
+	// Two empty blocks mark the end of the archive
+	_stream->writeZeros(2 * kBlockSize);
+	_stream->flush();
+
+	_finished = true;
+}
+
+void TarWriter::writeHeader(const UString &fileName, uint64_t size) {
+	char header[kBlockSize];
+	std::memset(header, 0, sizeof(header));
+
+	char * const name     = header +   0;
+	char * const mode     = header + 100;
+	char * const uid      = header + 108;
+	char * const gid      = header + 116;
+	char * const fileSize = header + 124;
+	char * const mtime    = header + 136;
+	char * const checksum = header + 148;
+	char * const type     = header + 156;
+	char * const magic    = header + 257;
+	char * const version  = header + 263;
+	char * const prefix   = header + 345;
+
+	/* Names longer than 100 characters are split at a directory separator
+	 * into a prefix of up to 155 characters and the name proper. */
+	const size_t length = std::strlen(fileName.c_str());
+	if (length == 0)
+		throw Exception("Empty file name");
+
+	if (length <= 100) {
+		std::memcpy(name, fileName.c_str(), length);
+	} else {
+		const char *split = 0;
+		for (const char *s = fileName.c_str(); *s; s++)
+			if ((*s == '/') && (static_cast<size_t>(s - fileName.c_str()) <= 155) &&
+			    (static_cast<size_t>(fileName.c_str() + length - (s + 1)) <= 100))
+				split = s;
+
+		if (!split || (split == fileName.c_str()) || (*(split + 1) == '\0'))
+			throw Exception("File name \"%s\" too long for a tar archive", fileName.c_str());
+
+		std::memcpy(prefix, fileName.c_str(), split - fileName.c_str());
+		std::memcpy(name, split + 1, fileName.c_str() + length - (split + 1));
+	}
+
+	writeOctal(mode, 8, 0644);
+	writeOctal(uid , 8, 0);
+	writeOctal(gid , 8, 0);
+
+	if (!writeOctal(fileSize, 12, size))
+		writeBase256(fileSize, 12, size);
+
+	writeOctal(mtime, 12, static_cast<uint64_t>(_time));
+
+	*type = '0';
+
+	std::memcpy(magic  , "ustar", 6);
+	std::memcpy(version, "00"   , 2);
+
+	// The checksum is calculated with the checksum field itself filled with spaces
+	std::memset(checksum, ' ', 8);
+
+	uint32_t sum = 0;
+	for (size_t i = 0; i < sizeof(header); i++)
+		sum += static_cast<byte>(header[i]);
+
+	writeOctal(checksum, 7, sum);
+
+	_stream->writeChecked(header, sizeof(header));
+}
+
+} // End of namespace Common
@@ -0,0 +1,87 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Writing tar archives.
+ */
+
+#ifndef COMMON_TARWRITER_H
+#define COMMON_TARWRITER_H
+
+#include <ctime>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+
+namespace Common {
+
+class ReadStream;
+class WriteStream;
+
+/** Write files as a POSIX ustar archive into a stream.
+ *
+ *  The archive is written strictly sequentially, one file after the other,
+ *  so it can be written into a non-seekable stream like stdout. The size of
+ *  each file therefore has to be known before its data is written.
+ *
+ *  Files larger than 8 GiB are supported with the GNU base-256 size encoding.
+ */
+class TarWriter : boost::noncopyable {
+public:
+	TarWriter(WriteStream &stream);
+	~TarWriter();
+
+	/** Add a file to the archive.
+	 *
+	 *  The file's data is copied from the stream without seeking, so it may be
+	 *  decompressed on the fly while it's written. If the stream ends before
+	 *  size bytes were read, or if reading the stream throws, the missing data
+	 *  is filled with zeros, to keep the archive itself intact, and an exception
+	 *  is thrown.
+	 *
+	 *  @param fileName The file's path within the archive, using '/' as separator.
+	 *  @param data The file's data.
+	 *  @param size The file's size.
+	 */
+	void add(const UString &fileName, ReadStream &data, uint64_t size);
+
+	/** Write the end-of-archive marker.
+	 *
+	 *  No more files can be added afterwards.
+	 */
+	void finish();
+
+private:
+	WriteStream *_stream;
+
+	std::time_t _time;
+
+	bool _finished;
+
+	void writeHeader(const UString &fileName, uint64_t size);
+	/** Fill the rest of a file with zeros, up to the next block boundary. */
+	void writePadding(uint64_t size, uint64_t left);
+};
+
+} // End of namespace Common
+
+#endif // COMMON_TARWRITER_H
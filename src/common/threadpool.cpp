@@ -0,0 +1,83 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A simple pool of worker threads.
+ */
+
+#include "src/common/threadpool.h"
+
+namespace Common {
+
+ThreadPool::ThreadPool(size_t threadCount) : _stop(false) {
+	if (threadCount == 0)
+		threadCount = getHardwareThreadCount();
+
+	_threads.reserve(threadCount);
+	for (size_t i = 0; i < threadCount; i++)
+		_threads.emplace_back(&ThreadPool::run, this);
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_stop = true;
+	}
+
+	_condition.notify_all();
+
+	for (std::vector<std::thread>::iterator t = _threads.begin(); t != _threads.end(); ++t)
+		t->join();
+}
+
+size_t ThreadPool::getThreadCount() const {
+	return _threads.size();
+}
+
+size_t ThreadPool::getHardwareThreadCount() {
+	const unsigned int count = std::thread::hardware_concurrency();
+
+	return (count == 0) ? 1 : count;
+}
+
+void ThreadPool::run() {
+	while (true) {
+		std::function<void()> job;
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			_condition.wait(lock, [this]() { return _stop || !_jobs.empty(); });
+
+			// Only stop once all queued jobs have been started
+			if (_jobs.empty())
+				return;
+
+			job = std::move(_jobs.front());
+			_jobs.pop_front();
+		}
+
+		// Exceptions are caught by the packaged_task and delivered through its future
+		job();
+	}
+}
+
+} // End of namespace Common
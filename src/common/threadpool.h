@@ -0,0 +1,106 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A simple pool of worker threads.
+ */
+
+#ifndef COMMON_THREADPOOL_H
+#define COMMON_THREADPOOL_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <type_traits>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+
+namespace Common {
+
+/** A fixed-size pool of worker threads, executing queued jobs.
+ *
+ *  Jobs are started in the order they were added. The result of a job,
+ *  including any exception it threw, is delivered through the std::future
+ *  returned by addJob().
+ *
+ *  Since jobs are started strictly in order, a job may safely wait for the
+ *  future of any job that was added before it.
+ */
+class ThreadPool : boost::noncopyable {
+public:
+	/** Create a thread pool.
+	 *
+	 *  @param threadCount The number of worker threads to start. If 0,
+	 *                     one thread per hardware thread is started.
+	 */
+	ThreadPool(size_t threadCount = 0);
+	/** Finish all queued jobs, then stop the worker threads. */
+	~ThreadPool();
+
+	/** Return the number of worker threads in this pool. */
+	size_t getThreadCount() const;
+
+	/** Queue a job for execution on one of the worker threads. */
+	template<typename F>
+	std::future<typename std::result_of<F()>::type> addJob(F &&job) {
+		typedef typename std::result_of<F()>::type Result;
+
+		std::shared_ptr<std::packaged_task<Result()>> task =
+			std::make_shared<std::packaged_task<Result()>>(std::forward<F>(job));
+
+		std::future<Result> future = task->get_future();
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			_jobs.emplace_back([task]() { (*task)(); });
+		}
+
+		_condition.notify_one();
+
+		return future;
+	}
+
+	/** Return the number of hardware threads available, at least 1. */
+	static size_t getHardwareThreadCount();
+
+private:
+	std::vector<std::thread> _threads;
+
+	std::deque<std::function<void()>> _jobs;
+
+	std::mutex _mutex;
+	std::condition_variable _condition;
+
+	bool _stop;
+
+	void run();
+};
+
+} // End of namespace Common
+
+#endif // COMMON_THREADPOOL_H
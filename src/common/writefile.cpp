@@ -35,8 +35,8 @@ namespace Common {
 WriteFile::WriteFile() : _handle(0), _size(0) {
 }
 
-WriteFile::WriteFile(const UString &fileName) : _handle(0), _size(0) {
-	if (!open(fileName))
+WriteFile::WriteFile(const UString &fileName, bool update) : _handle(0), _size(0) {
+	if (!open(fileName, update))
 		throw Exception("Can't open file \"%s\" for writing", fileName.c_str());
 }
 
@@ -47,13 +47,27 @@ WriteFile::~WriteFile() {
 	}
 }
 
-bool WriteFile::open(const UString &fileName) {
+bool WriteFile::open(const UString &fileName, bool update) {
 	close();
 
 	UString path = FilePath::normalize(fileName);
 	if (path.empty())
 		return false;
 
+	if (update) {
+		if (!(_handle = Platform::openFile(path, Platform::kFileModeUpdate)))
+			return false;
+
+		const long size = (std::fseek(_handle, 0, SEEK_END) == 0) ? std::ftell(_handle) : -1;
+		if ((size < 0) || (std::fseek(_handle, 0, SEEK_SET) != 0)) {
+			close();
+			return false;
+		}
+
+		_size = size;
+		return true;
+	}
+
 	try {
 		FilePath::createDirectories(FilePath::getDirectory(path));
 	} catch (...) {
@@ -41,15 +41,21 @@ class UString;
 class WriteFile : boost::noncopyable, public SeekableWriteStream {
 public:
 	WriteFile();
-	WriteFile(const UString &fileName);
+	WriteFile(const UString &fileName, bool update = false);
 	~WriteFile();
 
 	/** Try to open the file with the given fileName.
+	 *
+	 *  Normally, the file is created, or truncated if it already exists.
+	 *  In update mode, the file has to exist already, and its contents
+	 *  are kept, so that parts of it can be overwritten and data can be
+	 *  appended to it.
 	 *
 	 *  @param  fileName the name of the file to open
+	 *  @param  update open an existing file without truncating it
 	 *  @return true if file was opened successfully, false otherwise
 	 */
-	bool open(const UString &fileName);
+	bool open(const UString &fileName, bool update = false);
 
 	/** Close the file, if open. */
 	void close();
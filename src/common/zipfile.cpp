@@ -43,6 +43,26 @@ ZipFile::ZipFile(SeekableReadStream *zip) : _zip(zip) {
 ZipFile::~ZipFile() {
 }
 
+static const uint32_t kTagCentralDir       = 0x02014B50;
+static const uint32_t kTagEndRecord        = 0x06054B50;
+static const uint32_t kTagZIP64EndRecord   = 0x06064B50;
+static const uint32_t kTagZIP64EndLocator  = 0x07064B50;
+static const uint32_t kTagLocalFileHeader  = 0x04034B50;
+
+static const uint16_t kExtraZIP64 = 0x0001;
+
+static const size_t kLocalHeaderSize = 30;
+
+static const uint64_t kInvalidDataOffset = UINT64_MAX;
+
+/** Make sure a 64-bit value from the ZIP is addressable on this platform. */
+static size_t checkSize(uint64_t value) {
+	if (static_cast<uint64_t>(static_cast<size_t>(value)) != value)
+		throw Exception("ZIP file too large for this platform");
+
+	return static_cast<size_t>(value);
+}
+
 void ZipFile::load(SeekableReadStream &zip) {
 	static const byte kEndRecord[4] = { 0x50, 0x4B, 0x05, 0x06 };
 
@@ -58,35 +78,42 @@ void ZipFile::load(SeekableReadStream &zip) {
 	uint16_t centralDirDisk = zip.readUint16LE();
 
 	uint16_t curDiskDirs = zip.readUint16LE();
-	uint16_t totalDirs   = zip.readUint16LE();
+	uint16_t totalDirs16 = zip.readUint16LE();
 
-	if ((curDisk != 0) || (curDisk != centralDirDisk) || (curDiskDirs != totalDirs))
+	if ((curDisk != 0) || (curDisk != centralDirDisk) || (curDiskDirs != totalDirs16))
 		throw Exception("Unsupported multi-disk ZIP file");
 
 	zip.skip(4); // Size of central directory
 
-	uint32_t centralDirPos = zip.readUint32LE();
-	zip.seek(centralDirPos);
+	uint64_t totalDirs     = totalDirs16;
+	uint64_t centralDirPos = zip.readUint32LE();
+
+	// A ZIP64 end of central directory record overrides the 16-bit and 32-bit values
+	readZIP64EndRecord(zip, endPos, totalDirs, centralDirPos);
+
+	zip.seek(checkSize(centralDirPos));
 
 	uint32_t tag = zip.readUint32LE();
-	if (tag != 0x02014B50)
+	if (tag != kTagCentralDir)
 		throw Exception("Unknown ZIP record %08X", tag);
 
-	_iFiles.reserve(totalDirs);
-	while (tag == 0x02014B50) {
+	// Don't trust the file count blindly: each central directory record is at least 46 bytes
+	_iFiles.reserve(static_cast<size_t>(MIN<uint64_t>(totalDirs, zip.size() / 46)));
+	while (tag == kTagCentralDir) {
 		 File  file;
 		IFile iFile;
 
-		zip.skip(20);
+		zip.skip(16);
 
-		iFile.size = zip.readUint32LE();
+		iFile.compSize = zip.readUint32LE();
+		iFile.size     = zip.readUint32LE();
 
 		uint16_t nameLength    = zip.readUint16LE();
 		uint16_t extraLength   = zip.readUint16LE();
 		uint16_t commentLength = zip.readUint16LE();
 		uint16_t diskNum       = zip.readUint16LE();
 
-		if (diskNum != 0)
+		if ((diskNum != 0) && (diskNum != 0xFFFF))
 			throw Exception("Unsupported multi-disk ZIP file");
 
 		zip.skip(6); // File attributes
@@ -95,11 +122,15 @@ void ZipFile::load(SeekableReadStream &zip) {
 
 		file.name = readStringFixed(zip, kEncodingASCII, nameLength).toLower();
 
-		zip.skip(extraLength);
+		readZIP64Extra(zip, extraLength, iFile);
 		zip.skip(commentLength);
 
+		checkSize(iFile.offset);
+		checkSize(iFile.compSize);
+		checkSize(iFile.size);
+
 		tag = zip.readUint32LE();
-		if ((tag != 0x02014B50) && (tag != 0x06054B50))
+		if ((tag != kTagCentralDir) && (tag != kTagEndRecord) && (tag != kTagZIP64EndRecord))
 			throw Exception("Unknown ZIP record %08X", tag);
 
 		// Ignore empty file names
@@ -116,6 +147,82 @@ void ZipFile::load(SeekableReadStream &zip) {
 			}
 		}
 	}
+
+	// Read all local file headers now, so that accessing a file later only reads its data
+	for (IFileList::iterator iFile = _iFiles.begin(); iFile != _iFiles.end(); ++iFile)
+		readLocalHeader(zip, *iFile);
+}
+
+bool ZipFile::readZIP64EndRecord(SeekableReadStream &zip, size_t endPos,
+		uint64_t &totalDirs, uint64_t &centralDirPos) {
+
+	static const size_t kLocatorSize = 20;
+
+	// The ZIP64 end of central directory locator sits right in front of the end record
+	if (endPos < kLocatorSize)
+		return false;
+
+	std::unique_ptr<MemoryReadStream> locator(zip.readStreamAt(endPos - kLocatorSize, kLocatorSize));
+	if (locator->readUint32LE() != kTagZIP64EndLocator)
+		return false;
+
+	const uint32_t endRecordDisk = locator->readUint32LE();
+	const uint64_t endRecordPos  = locator->readUint64LE();
+	const uint32_t totalDisks    = locator->readUint32LE();
+
+	if ((endRecordDisk != 0) || (totalDisks > 1))
+		throw Exception("Unsupported multi-disk ZIP file");
+
+	zip.seek(checkSize(endRecordPos));
+
+	uint32_t tag = zip.readUint32LE();
+	if (tag != kTagZIP64EndRecord)
+		throw Exception("Unknown ZIP64 record %08X", tag);
+
+	zip.skip(8); // Size of the ZIP64 end of central directory record
+	zip.skip(4); // Version made by, version needed to extract
+
+	uint32_t curDisk        = zip.readUint32LE();
+	uint32_t centralDirDisk = zip.readUint32LE();
+
+	uint64_t curDiskDirs = zip.readUint64LE();
+	totalDirs = zip.readUint64LE();
+
+	if ((curDisk != 0) || (curDisk != centralDirDisk) || (curDiskDirs != totalDirs))
+		throw Exception("Unsupported multi-disk ZIP file");
+
+	zip.skip(8); // Size of central directory
+
+	centralDirPos = zip.readUint64LE();
+
+	return true;
+}
+
+void ZipFile::readZIP64Extra(SeekableReadStream &zip, size_t extraLength, IFile &iFile) {
+	const size_t extraEnd = zip.pos() + extraLength;
+
+	while ((zip.pos() + 4) <= extraEnd) {
+		const uint16_t id   = zip.readUint16LE();
+		const uint16_t size = zip.readUint16LE();
+
+		const size_t fieldEnd = zip.pos() + size;
+		if (fieldEnd > extraEnd)
+			throw Exception("Invalid ZIP extra field");
+
+		if (id == kExtraZIP64) {
+			// Only the values that overflowed their 32-bit field are present, in this order
+			if ((iFile.size == 0xFFFFFFFF) && ((zip.pos() + 8) <= fieldEnd))
+				iFile.size = zip.readUint64LE();
+			if ((iFile.compSize == 0xFFFFFFFF) && ((zip.pos() + 8) <= fieldEnd))
+				iFile.compSize = zip.readUint64LE();
+			if ((iFile.offset == 0xFFFFFFFF) && ((zip.pos() + 8) <= fieldEnd))
+				iFile.offset = zip.readUint64LE();
+		}
+
+		zip.seek(fieldEnd);
+	}
+
+	zip.seek(extraEnd);
 }
 
 const ZipFile::FileList &ZipFile::getFiles() const {
@@ -129,29 +236,43 @@ const ZipFile::IFile &ZipFile::getIFile(uint32_t index) const {
 	return _iFiles[index];
 }
 
-void ZipFile::getFileProperties(SeekableReadStream &zip, const IFile &file,
-		uint16_t &compMethod, uint32_t &compSize, uint32_t &realSize) const {
+const ZipFile::IFile &ZipFile::getReadableIFile(uint32_t index) const {
+	const IFile &file = getIFile(index);
 
-	zip.seek(file.offset);
+	if (file.dataOffset == kInvalidDataOffset)
+		throw Exception("Invalid local file header for file %u", index);
 
-	uint32_t tag = zip.readUint32LE();
-	if (tag != 0x04034B50)
-		throw Exception("Unknown ZIP record %08X", tag);
+	if ((file.method != 0) && (file.method != 8))
+		throw Exception("Unhandled Zip compression %d", file.method);
+
+	return file;
+}
 
-	zip.skip(4);
+void ZipFile::readLocalHeader(SeekableReadStream &zip, IFile &iFile) {
+	iFile.dataOffset = kInvalidDataOffset;
+	iFile.method     = 0;
 
-	compMethod = zip.readUint16LE();
+	/* A broken local header only makes this one file unreadable, so it's
+	 * marked as such here, and only reported when the file is accessed. */
+	if ((iFile.offset + kLocalHeaderSize) > zip.size())
+		return;
 
-	zip.skip(8);
+	byte header[kLocalHeaderSize];
+	if (zip.readAt(iFile.offset, header, kLocalHeaderSize) != kLocalHeaderSize)
+		return;
 
-	compSize = zip.readUint32LE();
-	realSize = zip.readUint32LE();
+	if (READ_LE_UINT32(header) != kTagLocalFileHeader)
+		return;
 
-	uint16_t nameLength  = zip.readUint16LE();
-	uint16_t extraLength = zip.readUint16LE();
+	/* We skip the time, date, CRC and sizes. The sizes might be missing here, when
+	 * they're found in a data descriptor after the file's data, or overflowed
+	 * into a ZIP64 extra field. We use the ones from the central directory instead. */
 
-	zip.skip(nameLength);
-	zip.skip(extraLength);
+	const uint16_t nameLength  = READ_LE_UINT16(header + 26);
+	const uint16_t extraLength = READ_LE_UINT16(header + 28);
+
+	iFile.method     = READ_LE_UINT16(header + 8);
+	iFile.dataOffset = iFile.offset + kLocalHeaderSize + nameLength + extraLength;
 }
 
 size_t ZipFile::getFileSize(uint32_t index) const {
@@ -159,22 +280,22 @@ size_t ZipFile::getFileSize(uint32_t index) const {
 }
 
 SeekableReadStream *ZipFile::getFile(uint32_t index, bool tryNoCopy) const {
-	const IFile &file = getIFile(index);
+	const IFile &file = getReadableIFile(index);
 
-	uint16_t compMethod;
-	uint32_t compSize;
-	uint32_t realSize;
+	const size_t dataOffset = file.dataOffset;
+	const size_t compSize   = file.compSize;
+	const size_t realSize   = file.size;
 
-	getFileProperties(*_zip, file, compMethod, compSize, realSize);
+	if (tryNoCopy && (file.method == 0))
+		return _zip->getSubStream(dataOffset, dataOffset + compSize);
 
-	if (tryNoCopy && (compMethod == 0))
-		return new SeekableSubReadStream(_zip.get(), _zip->pos(), _zip->pos() + compSize);
+	std::unique_ptr<MemoryReadStream> compData(_zip->readStreamAt(dataOffset, compSize));
 
-	return decompressFile(*_zip, compMethod, compSize, realSize);
+	return decompressFile(*compData, file.method, compSize, realSize);
 }
 
 SeekableReadStream *ZipFile::decompressFile(SeekableReadStream &zip, uint32_t method,
-		uint32_t compSize, uint32_t realSize) {
+		size_t compSize, size_t realSize) {
 
 	if (method == 0) {
 		// Uncompressed
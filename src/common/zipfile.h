@@ -38,7 +38,13 @@ namespace Common {
 
 class SeekableReadStream;
 
-/** A class encapsulating ZIP file access. */
+/** A class encapsulating ZIP file access.
+ *
+ *  ZIP64 archives, with 64-bit offsets, sizes and file counts, are supported.
+ *
+ *  The local file headers are read once, when the ZIP is opened. Accessing a
+ *  file afterwards only reads its data.
+ */
 class ZipFile : boost::noncopyable {
 public:
 	/** A file. */
@@ -58,14 +64,22 @@ public:
 	/** Return the size of a file. */
 	size_t getFileSize(uint32_t index) const;
 
-	/** Return a stream of the file's contents. */
+	/** Return a stream of the file's contents.
+	 *
+	 *  This may be called from several threads at once.
+	 */
 	SeekableReadStream *getFile(uint32_t index, bool tryNoCopy = false) const;
 
 private:
 	/** Internal file information. */
 	struct IFile {
-		uint32_t offset; ///< The offset of the file within the ZIP.
-		uint32_t size;   ///< The file's size.
+		uint64_t offset;   ///< The offset of the file's local header within the ZIP.
+		uint64_t compSize; ///< The file's compressed size.
+		uint64_t size;     ///< The file's size.
+
+		/** The offset of the file's data within the ZIP, or UINT64_MAX if the local header is broken. */
+		uint64_t dataOffset;
+		uint16_t method; ///< The file's compression method.
 	};
 
 	typedef std::vector<IFile> IFileList;
@@ -80,12 +94,21 @@ private:
 
 	void load(SeekableReadStream &zip);
 
+	/** Read the ZIP64 end of central directory record, if there is one. */
+	static bool readZIP64EndRecord(SeekableReadStream &zip, size_t endPos,
+			uint64_t &totalDirs, uint64_t &centralDirPos);
+	/** Read the 64-bit values of a ZIP64 extended information extra field. */
+	static void readZIP64Extra(SeekableReadStream &zip, size_t extraLength, IFile &iFile);
+
+	/** Read the local file header, to find the file's data offset and compression method. */
+	static void readLocalHeader(SeekableReadStream &zip, IFile &iFile);
+
 	static SeekableReadStream *decompressFile(SeekableReadStream &zip, uint32_t method,
-			uint32_t compSize, uint32_t realSize);
+			size_t compSize, size_t realSize);
 
 	const IFile &getIFile(uint32_t index) const;
-	void getFileProperties(SeekableReadStream &zip, const IFile &file,
-			uint16_t &compMethod, uint32_t &compSize, uint32_t &realSize) const;
+	/** Return the file information, making sure the file's data can be read. */
+	const IFile &getReadableIFile(uint32_t index) const;
 };
 
 } // End of namespace Common
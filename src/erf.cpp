@@ -25,6 +25,7 @@
 #include <set>
 
 #include "src/common/error.h"
+#include "src/common/strutil.h"
 #include "src/common/platform.h"
 #include "src/common/cli.h"
 #include "src/common/readfile.h"
@@ -32,6 +33,7 @@
 #include "src/common/filepath.h"
 
 #include "src/aurora/erfwriter.h"
+#include "src/aurora/erfupdater.h"
 #include "src/aurora/util.h"
 
 #include "src/util.h"
@@ -41,10 +43,21 @@ static const uint32_t kMODID = MKTAG('M', 'O', 'D', ' ');
 static const uint32_t kHAKID = MKTAG('H', 'A', 'K', ' ');
 static const uint32_t kSAVID = MKTAG('S', 'A', 'V', ' ');
 
+enum Command {
+	kCommandPack   , ///< Pack files into a new archive.
+	kCommandUpdate , ///< Add or replace files in an existing archive.
+	kCommandDelete , ///< Delete files from an existing archive.
+	kCommandCompact  ///< Remove unused space from an existing archive.
+};
+
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Common::UString &archive, std::set<Common::UString> &files,
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
                       Aurora::ERFWriter::Version &version, Aurora::ERFWriter::Compression &compression,
-                      uint32_t &id, Aurora::GameID &game);
+                      uint32_t &id, Aurora::GameID &game, uint32_t &jobs, bool &deduplicate);
+
+void updateFiles(const Common::UString &archive, const std::set<Common::UString> &files, Aurora::GameID game);
+void deleteFiles(const Common::UString &archive, const std::set<Common::UString> &files, Aurora::GameID game);
+void compactArchive(const Common::UString &archive);
 
 int main(int argc, char **argv) {
 	initPlatform();
@@ -56,15 +69,34 @@ int main(int argc, char **argv) {
 		Aurora::GameID game = Aurora::kGameIDUnknown;
 
 		int returnValue = 1;
+		Command command = kCommandPack;
 		uint32_t id = kERFID;
+		uint32_t jobs = 1;
+		bool deduplicate = false;
 		Common::UString archive;
 		Aurora::ERFWriter::Version version = Aurora::ERFWriter::kERFVersion10;
 		Aurora::ERFWriter::Compression compression = Aurora::ERFWriter::kCompressionNone;
 		std::set<Common::UString> files;
 
-		if (!parseCommandLine(args, returnValue, archive, files, version, compression, id, game))
+		if (!parseCommandLine(args, returnValue, command, archive, files, version, compression, id, game, jobs,
+		                      deduplicate))
 			return returnValue;
 
+		if (command == kCommandUpdate) {
+			updateFiles(archive, files, game);
+			return 0;
+		}
+
+		if (command == kCommandDelete) {
+			deleteFiles(archive, files, game);
+			return 0;
+		}
+
+		if (command == kCommandCompact) {
+			compactArchive(archive);
+			return 0;
+		}
+
 		if (compression != Aurora::ERFWriter::kCompressionNone && version != Aurora::ERFWriter::kERFVersion22)
 			throw Common::Exception("Compression is only allowed in ERF V2.2");
 
@@ -75,7 +107,8 @@ int main(int argc, char **argv) {
 		Common::WriteFile writeFile(archive);
 
 		size_t i = 1;
-		Aurora::ERFWriter erfWriter(id, files.size(), writeFile, version, compression);
+		Aurora::ERFWriter erfWriter(id, files.size(), writeFile, version, compression,
+		                            Aurora::LocString(), jobs, 0, deduplicate);
 		for (std::set<Common::UString>::const_iterator iter = files.begin(); iter != files.end(); ++iter, ++i) {
 			std::printf("Packing %u/%u: %s ... ", (uint)i, (uint)files.size(), iter->c_str());
 			std::fflush(stdout);
@@ -88,6 +121,11 @@ int main(int argc, char **argv) {
 			erfWriter.add(Common::FilePath::getStem(file), type, fileStream);
 			std::printf("Done\n");
 		}
+
+		erfWriter.flush();
+
+		if (deduplicate)
+			std::printf("Deduplication saved %s bytes\n", Common::composeString(erfWriter.getBytesSaved()).c_str());
 	} catch (...) {
 		Common::exceptionDispatcherError();
 	}
@@ -95,10 +133,75 @@ int main(int argc, char **argv) {
 	return 0;
 }
 
+static void printUnusedSize(const Common::UString &archive, const Aurora::ERFUpdater &erf) {
+	std::printf("%s of %s bytes in the archive are unused\n",
+	            Common::composeString(erf.getUnusedSize()).c_str(),
+	            Common::composeString(Common::FilePath::getFileSize(archive)).c_str());
+}
+
+void updateFiles(const Common::UString &archive, const std::set<Common::UString> &files, Aurora::GameID game) {
+	for (const auto &file : files)
+		if (file.equalsIgnoreCase(archive))
+			throw Common::Exception("Trying to pack file \"%s\" into itself?!?", file.c_str());
+
+	Aurora::ERFUpdater erf(archive);
+
+	size_t i = 1;
+	for (std::set<Common::UString>::const_iterator iter = files.begin(); iter != files.end(); ++iter, ++i) {
+		std::printf("Updating %u/%u: %s ... ", (uint)i, (uint)files.size(), iter->c_str());
+		std::fflush(stdout);
+
+		Common::ReadFile fileStream(*iter);
+
+		const Aurora::FileType type = TypeMan.unaliasFileType(TypeMan.getFileType(*iter), game);
+
+		erf.add(Common::FilePath::getStem(*iter), type, fileStream);
+		std::printf("Done\n");
+	}
+
+	erf.flush();
+
+	printUnusedSize(archive, erf);
+}
+
+void deleteFiles(const Common::UString &archive, const std::set<Common::UString> &files, Aurora::GameID game) {
+	Aurora::ERFUpdater erf(archive);
+
+	size_t i = 1;
+	for (std::set<Common::UString>::const_iterator iter = files.begin(); iter != files.end(); ++iter, ++i) {
+		std::printf("Deleting %u/%u: %s ... ", (uint)i, (uint)files.size(), iter->c_str());
+		std::fflush(stdout);
+
+		const Aurora::FileType type = TypeMan.unaliasFileType(TypeMan.getFileType(*iter), game);
+
+		if (!erf.remove(Common::FilePath::getStem(*iter), type))
+			std::printf("Not found\n");
+		else
+			std::printf("Done\n");
+	}
+
+	erf.flush();
+
+	printUnusedSize(archive, erf);
+}
+
+void compactArchive(const Common::UString &archive) {
+	Aurora::ERFUpdater erf(archive);
+
+	const size_t unusedSize = erf.getUnusedSize();
+
+	std::printf("Compacting %s ... ", archive.c_str());
+	std::fflush(stdout);
+
+	erf.compact();
+
+	std::printf("Done, %s bytes reclaimed\n", Common::composeString(unusedSize).c_str());
+}
+
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Common::UString &archive, std::set<Common::UString> &files,
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
                       Aurora::ERFWriter::Version &version, Aurora::ERFWriter::Compression &compression,
-                      uint32_t &id, Aurora::GameID &game) {
+                      uint32_t &id, Aurora::GameID &game, uint32_t &jobs, bool &deduplicate) {
 	using Common::CLI::NoOption;
 	using Common::CLI::kContinueParsing;
 	using Common::CLI::Parser;
@@ -118,6 +221,16 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	              makeEndArgs(&archiveOpt, &filesOpt));
 
 	parser.addSpace();
+	parser.addOption("update", 'u', "Add or replace files in an existing archive",
+	                 kContinueParsing,
+	                 makeAssigners(new ValAssigner<Command>(kCommandUpdate, command)));
+	parser.addOption("delete", 'd', "Delete files from an existing archive",
+	                 kContinueParsing,
+	                 makeAssigners(new ValAssigner<Command>(kCommandDelete, command)));
+	parser.addOption("compact", "Remove unused space from an existing archive",
+	                 kContinueParsing,
+	                 makeAssigners(new ValAssigner<Command>(kCommandCompact, command)));
+	parser.addSpace();
 	parser.addOption("erf", "Set ERF as archive id (default)",
 	                 kContinueParsing,
 	                 makeAssigners(new ValAssigner<uint32_t>(kERFID, id)));
@@ -147,6 +260,12 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	parser.addOption("zlib", "Compress using headerless zlib method",
 	                 kContinueParsing,
 	                 makeAssigners(new ValAssigner<Aurora::ERFWriter::Compression>(Aurora::ERFWriter::kCompressionHeaderlessZlib, compression)));
+	parser.addOption("jobs", 'j', "Compress files using this many threads in parallel "
+	                 "(0: one per CPU core)", kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+	parser.addOption("dedup", "Only write the data of identical files once",
+	                 kContinueParsing,
+	                 makeAssigners(new ValAssigner<bool>(true, deduplicate)));
 	parser.addSpace();
 	parser.addOption("jade", "Unalias file types according to Jade Empire rules",
 	                 kContinueParsing,
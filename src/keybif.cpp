@@ -23,14 +23,19 @@
  */
 
 #include <set>
+#include <vector>
+#include <memory>
+#include <future>
 
 #include "src/aurora/keydatafile.h"
 #include "src/common/error.h"
+#include "src/common/strutil.h"
 #include "src/common/platform.h"
 #include "src/common/cli.h"
 #include "src/common/readfile.h"
 #include "src/common/writefile.h"
 #include "src/common/filepath.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/bifwriter.h"
 #include "src/aurora/bzfwriter.h"
@@ -42,10 +47,21 @@
 struct BIFGroup {
 	Common::UString name;
 	std::list<Common::UString> files;
+	/** The types of the files, detected up front since the type manager isn't thread-safe. */
+	std::list<Aurora::FileType> types;
+};
+
+/** The result of writing one BIF group. */
+struct BIFResult {
+	size_t size;         ///< The size of the written BIF/BZF file.
+	uint64_t bytesSaved; ///< The number of bytes saved by deduplication.
 };
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Common::UString &keyfile, std::set<Common::UString> &files);
+                      Common::UString &keyfile, std::set<Common::UString> &files, bool &deduplicate,
+                      uint32_t &jobs);
+
+BIFResult writeBIF(const BIFGroup &group, bool deduplicate);
 
 int main(int argc, char **argv) {
 	initPlatform();
@@ -55,16 +71,20 @@ int main(int argc, char **argv) {
 		Common::Platform::getParameters(argc, argv, args);
 
 		int returnValue = 1;
+		bool deduplicate = false;
+		uint32_t jobs = 1;
 		Common::UString keyFile;
 		std::set<Common::UString> files;
 
-		if (!parseCommandLine(args, returnValue, keyFile, files))
+		if (!parseCommandLine(args, returnValue, keyFile, files, deduplicate, jobs))
 			return returnValue;
 
 		Aurora::KEYWriter keyWriter;
 
 		std::list<BIFGroup> groups;
 
+		uint64_t bytesSaved = 0;
+
 		for (const auto &file : files) {
 			if (file.endsWith(".bif") || file.endsWith(".bzf")) {
 				BIFGroup group;
@@ -75,6 +95,7 @@ int main(int argc, char **argv) {
 				if (groups.empty())
 					throw Common::Exception("Files have to start with a bif or bzf archive");
 				groups.back().files.push_back(file);
+				groups.back().types.push_back(TypeMan.getFileType(file));
 			}
 		}
 
@@ -83,33 +104,34 @@ int main(int argc, char **argv) {
 				if (file.equalsIgnoreCase(group.name))
 					throw Common::Exception("Trying to pack file \"%s\" into itself?!?", file.c_str());
 
-		for (const auto &group : groups) {
-			std::printf("Packing %s ... \n", group.name.c_str());
+		/* The BIF groups are independent of each other, so they're written in
+		 * parallel. Only the KEY needs the sizes of all BIFs, so it's written
+		 * last, with the BIFs added in their original order. */
+		Common::ThreadPool pool(jobs);
 
-			Common::WriteFile writeBIFFile(group.name);
-			std::unique_ptr<Aurora::KEYDataWriter> dataFile;
+		std::vector<std::future<BIFResult>> results;
+		results.reserve(groups.size());
 
-			if (group.name.endsWith(".bzf"))
-				dataFile = std::make_unique<Aurora::BZFWriter>(group.files.size(), writeBIFFile);
-			else
-				dataFile = std::make_unique<Aurora::BIFWriter>(group.files.size(), writeBIFFile);
+		for (const auto &group : groups)
+			results.push_back(pool.addJob([&group, deduplicate]() { return writeBIF(group, deduplicate); }));
 
-			size_t i = 1;
-			for (const auto &file : group.files) {
-				std::printf("\tPacking %u/%u: %s ... ", (uint)i, static_cast<uint>(group.files.size()), file.c_str());
-				std::fflush(stdout);
+		size_t groupIndex = 0;
+		for (const auto &group : groups) {
+			std::printf("Packing %s ... ", group.name.c_str());
+			std::fflush(stdout);
 
-				Common::ReadFile packFile(file);
-				dataFile->add(packFile, TypeMan.getFileType(file));
+			const BIFResult result = results[groupIndex++].get();
 
-				++i;
+			std::printf("Done (%s files)\n", Common::composeString(group.files.size()).c_str());
 
-				std::printf("Done\n");
-			}
+			keyWriter.addBIF(group.name, group.files, result.size);
 
-			keyWriter.addBIF(group.name, group.files, dataFile->size());
+			bytesSaved += result.bytesSaved;
 		}
 
+		if (deduplicate)
+			std::printf("Deduplication saved %s bytes\n", Common::composeString(bytesSaved).c_str());
+
 		Common::WriteFile writeFile(keyFile);
 		keyWriter.write(writeFile);
 	} catch (...) {
@@ -119,8 +141,65 @@ int main(int argc, char **argv) {
 	return 0;
 }
 
+/** Read a whole file into memory. */
+static std::unique_ptr<Common::SeekableReadStream> readFile(const Common::UString &fileName) {
+	Common::ReadFile file(fileName);
+
+	return std::unique_ptr<Common::SeekableReadStream>(file.readStream(file.size()));
+}
+
+BIFResult writeBIF(const BIFGroup &group, bool deduplicate) {
+	try {
+		Common::WriteFile writeBIFFile(group.name);
+		std::unique_ptr<Aurora::KEYDataWriter> dataFile;
+
+		if (group.name.endsWith(".bzf"))
+			dataFile = std::make_unique<Aurora::BZFWriter>(group.files.size(), writeBIFFile);
+		else
+			dataFile = std::make_unique<Aurora::BIFWriter>(group.files.size(), writeBIFFile, deduplicate);
+
+		// Read the next file while the current one is written
+		std::future<std::unique_ptr<Common::SeekableReadStream>> nextFile;
+
+		std::list<Common::UString>::const_iterator file = group.files.begin();
+		std::list<Aurora::FileType>::const_iterator type = group.types.begin();
+		if (file != group.files.end())
+			nextFile = std::async(std::launch::async, readFile, *file);
+
+		while (file != group.files.end()) {
+			const Common::UString fileName = *file;
+
+			try {
+				std::unique_ptr<Common::SeekableReadStream> packFile = nextFile.get();
+
+				if (++file != group.files.end())
+					nextFile = std::async(std::launch::async, readFile, *file);
+
+				dataFile->add(*packFile, *type++);
+
+			} catch (Common::Exception &e) {
+				e.add("Failed packing \"%s\"", fileName.c_str());
+				throw;
+			}
+		}
+
+		writeBIFFile.flush();
+
+		BIFResult result;
+		result.size       = dataFile->size();
+		result.bytesSaved = dataFile->getBytesSaved();
+
+		return result;
+
+	} catch (Common::Exception &e) {
+		e.add("Failed writing \"%s\"", group.name.c_str());
+		throw;
+	}
+}
+
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Common::UString &keyfile, std::set<Common::UString> &files) {
+                      Common::UString &keyfile, std::set<Common::UString> &files, bool &deduplicate,
+                      uint32_t &jobs) {
 	using Common::CLI::NoOption;
 	using Common::CLI::kContinueParsing;
 	using Common::CLI::Parser;
@@ -139,5 +218,13 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 				  returnValue,
 				  makeEndArgs(&archiveOpt, &filesOpt));
 
+	parser.addSpace();
+	parser.addOption("dedup", "Only write the data of identical files within a BIF once (not for BZF)",
+	                 kContinueParsing,
+	                 makeAssigners(new ValAssigner<bool>(true, deduplicate)));
+	parser.addOption("jobs", 'j', "Write this many BIF files in parallel "
+	                 "(0: one per CPU core)", kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+
 	return parser.process(argv);
 }
@@ -25,6 +25,7 @@
 #include <set>
 
 #include "src/common/error.h"
+#include "src/common/strutil.h"
 #include "src/common/platform.h"
 #include "src/common/cli.h"
 #include "src/common/readfile.h"
@@ -38,7 +39,7 @@
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
                       Common::UString &archive, std::set<Common::UString> &files,
-                      Aurora::GameID &game);
+                      Aurora::GameID &game, bool &deduplicate);
 
 int main(int argc, char **argv) {
 	initPlatform();
@@ -50,10 +51,11 @@ int main(int argc, char **argv) {
 		Aurora::GameID game = Aurora::kGameIDUnknown;
 
 		int returnValue = 1;
+		bool deduplicate = false;
 		Common::UString archive;
 		std::set<Common::UString> files;
 
-		if (!parseCommandLine(args, returnValue, archive, files, game))
+		if (!parseCommandLine(args, returnValue, archive, files, game, deduplicate))
 			return returnValue;
 
 		for (const auto &file : files)
@@ -63,7 +65,7 @@ int main(int argc, char **argv) {
 		Common::WriteFile writeFile(archive);
 
 		size_t i = 1;
-		Aurora::RIMWriter rimWriter(files.size(), writeFile);
+		Aurora::RIMWriter rimWriter(files.size(), writeFile, deduplicate);
 		for (std::set<Common::UString>::const_iterator iter = files.begin(); iter != files.end(); ++iter, ++i) {
 			std::printf("Packing %u/%u: %s ... ", (uint)i, (uint)files.size(), iter->c_str());
 			std::fflush(stdout);
@@ -76,6 +78,9 @@ int main(int argc, char **argv) {
 			rimWriter.add(Common::FilePath::getStem(file), type, fileStream);
 			std::printf("Done\n");
 		}
+
+		if (deduplicate)
+			std::printf("Deduplication saved %s bytes\n", Common::composeString(rimWriter.getBytesSaved()).c_str());
 	} catch (...) {
 		Common::exceptionDispatcherError();
 	}
@@ -85,7 +90,7 @@ int main(int argc, char **argv) {
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
                       Common::UString &archive, std::set<Common::UString> &files,
-                      Aurora::GameID &game) {
+                      Aurora::GameID &game, bool &deduplicate) {
 	using Common::CLI::NoOption;
 	using Common::CLI::kContinueParsing;
 	using Common::CLI::Parser;
@@ -105,6 +110,10 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	              makeEndArgs(&archiveOpt, &filesOpt));
 
 	parser.addSpace();
+	parser.addOption("dedup", "Only write the data of identical files once",
+	                 kContinueParsing,
+	                 makeAssigners(new ValAssigner<bool>(true, deduplicate)));
+	parser.addSpace();
 	parser.addOption("jade", "Unalias file types according to Jade Empire rules",
 	                 kContinueParsing,
 	                 makeAssigners(new ValAssigner<GameID>(Aurora::kGameIDJade, game)));
@@ -412,6 +412,19 @@ src_fev2xml_LDADD = \
     $(LDADD) \
     $(EMPTY)
 
+bin_PROGRAMS += src/archdiff
+src_archdiff_SOURCES = \
+    src/archdiff.cpp \
+    src/util.cpp \
+    $(EMPTY)
+src_archdiff_LDADD = \
+    src/archives/libarchives.la \
+    src/aurora/libaurora.la \
+    src/common/libcommon.la \
+    src/version/libversion.la \
+    $(LDADD) \
+    $(EMPTY)
+
 # Subdirectories
 
 include src/version/rules.mk
@@ -35,6 +35,7 @@
 #include "src/common/error.h"
 #include "src/common/platform.h"
 #include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
 #include "src/common/md5.h"
 #include "src/common/cli.h"
 
@@ -52,14 +53,17 @@ enum Command {
 	kCommandListVerbose     ,
 	kCommandExtract         ,
 	kCommandExtractDir      ,
+	kCommandTar             ,
+	kCommandHash            ,
 	kCommandMAX
 };
 
-const char *kCommandChar[kCommandMAX] = { "i", "l", "v", "e", "x" };
+const char *kCommandChar[kCommandMAX] = { "i", "l", "v", "e", "x", "t", "h" };
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
                       Command &command, Common::UString &archive, std::set<Common::UString> &files,
-                      Aurora::GameID &game, std::vector<byte> &password);
+                      Aurora::GameID &game, std::vector<byte> &password, uint32_t &jobs,
+                      Common::UString &names);
 
 bool parsePassword(const Common::UString &arg, std::vector<byte> &password);
 bool readNWMMD5   (const Common::UString &arg, std::vector<byte> &password);
@@ -79,12 +83,17 @@ int main(int argc, char **argv) {
 		Command command = kCommandNone;
 		Common::UString archive;
 		std::set<Common::UString> files;
+		uint32_t jobs = 1;
+		Common::UString names;
 		std::vector<byte> password;
 
-		if (!parseCommandLine(args, returnValue, command, archive, files, game, password))
+		if (!parseCommandLine(args, returnValue, command, archive, files, game, password, jobs, names))
 			return returnValue;
 
-		Aurora::ERFFile erf(new Common::ReadFile(archive), password);
+		if (!names.empty())
+			Archives::loadNameDictionary(names);
+
+		Aurora::ERFFile erf(new Common::MappedFile(archive), password);
 		files = Archives::fixPathSeparator(files);
 
 		if      (command == kCommandInfo)
@@ -94,9 +103,17 @@ int main(int argc, char **argv) {
 		else if (command == kCommandListVerbose)
 			Archives::listFiles(erf, game, true);
 		else if (command == kCommandExtract)
-			Archives::extractFiles(erf, game, false, files);
+			Archives::extractFiles(erf, game, false, files, jobs);
 		else if (command == kCommandExtractDir)
-			Archives::extractFiles(erf, game, true, files);
+			Archives::extractFiles(erf, game, true, files, jobs);
+		else if (command == kCommandTar) {
+			if (!Archives::extractFilesTar(erf, game, true, files))
+				return 1;
+		}
+		else if (command == kCommandHash) {
+			if (!Archives::hashFiles(erf, game, true, files, jobs))
+				return 1;
+		}
 
 	} catch (...) {
 		Common::exceptionDispatcherError();
@@ -162,7 +179,8 @@ int ValGetter<Command &>::get(const std::vector<Common::UString> &args, int i, i
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
                       Command &command, Common::UString &archive, std::set<Common::UString> &files,
-                      Aurora::GameID &game, std::vector<byte> &password) {
+                      Aurora::GameID &game, std::vector<byte> &password, uint32_t &jobs,
+                      Common::UString &names) {
 
 	using Common::CLI::NoOption;
 	using Common::CLI::kContinueParsing;
@@ -183,7 +201,9 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	              "  l          List files (stripping directories)\n"
 	              "  v          List files verbosely (with directories)\n"
 	              "  e          Extract files to current directory, stripping directories\n"
-	              "  x          Extract files to current directory, creating subdirectories\n",
+	              "  x          Extract files to current directory, creating subdirectories\n"
+	              "  t          Write files as a tar archive to stdout, with subdirectories\n"
+	              "  h          Hash files, printing a manifest of their MD5 and CRC32 checksums\n",
 	              returnValue,
 	              makeEndArgs(&cmdOpt, &archiveOpt, &filesOpt));
 
@@ -203,6 +223,14 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	                 kContinueParsing,
 	                 new Callback<std::vector<byte> &>("file", readNWMMD5, password));
 
+	parser.addSpace();
+	parser.addOption("jobs", 'j', "Extract or hash files using this many threads in parallel "
+	                 "(0: one per CPU core)", kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+	parser.addOption("names", "Resolve hashed file names using this list of "
+	                 "additional file names, one per line", kContinueParsing,
+	                 new ValGetter<Common::UString &>(names, "file"));
+
 	return parser.process(argv);
 }
 
@@ -31,7 +31,7 @@
 #include "src/common/ustring.h"
 #include "src/common/error.h"
 #include "src/common/platform.h"
-#include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
 #include "src/common/cli.h"
 
 #include "src/aurora/util.h"
@@ -45,13 +45,16 @@ enum Command {
 	kCommandNone    = -1,
 	kCommandList    =  0,
 	kCommandExtract     ,
+	kCommandTar         ,
+	kCommandHash        ,
 	kCommandMAX
 };
 
-const char *kCommandChar[kCommandMAX] = { "l", "e" };
+const char *kCommandChar[kCommandMAX] = { "l", "e", "t", "h" };
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, Common::UString &archive, std::set<Common::UString> &files);
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
+                      uint32_t &jobs, Common::UString &names);
 
 int main(int argc, char **argv) {
 	initPlatform();
@@ -64,17 +67,30 @@ int main(int argc, char **argv) {
 		Command command = kCommandNone;
 		Common::UString archive;
 		std::set<Common::UString> files;
+		uint32_t jobs = 1;
+		Common::UString names;
 
-		if (!parseCommandLine(args, returnValue, command, archive, files))
+		if (!parseCommandLine(args, returnValue, command, archive, files, jobs, names))
 			return returnValue;
 
-		Aurora::HERFFile herf(new Common::ReadFile(archive));
+		if (!names.empty())
+			Archives::loadNameDictionary(names);
+
+		Aurora::HERFFile herf(new Common::MappedFile(archive));
 		files = Archives::fixPathSeparator(files);
 
 		if      (command == kCommandList)
 			Archives::listFiles(herf, Aurora::kGameIDUnknown, false);
 		else if (command == kCommandExtract)
-			Archives::extractFiles(herf, Aurora::kGameIDUnknown, false, files);
+			Archives::extractFiles(herf, Aurora::kGameIDUnknown, false, files, jobs);
+		else if (command == kCommandTar) {
+			if (!Archives::extractFilesTar(herf, Aurora::kGameIDUnknown, false, files))
+				return 1;
+		}
+		else if (command == kCommandHash) {
+			if (!Archives::hashFiles(herf, Aurora::kGameIDUnknown, false, files, jobs))
+				return 1;
+		}
 
 	} catch (...) {
 		Common::exceptionDispatcherError();
@@ -100,7 +116,8 @@ int ValGetter<Command &>::get(const std::vector<Common::UString> &args, int i, i
 }
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, Common::UString &archive, std::set<Common::UString> &files) {
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
+                      uint32_t &jobs, Common::UString &names) {
 
 	using Common::CLI::NoOption;
 	using Common::CLI::Parser;
@@ -113,9 +130,19 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	Parser parser(argv[0], "BioWare HERF archive extractor",
 	              "Commands:\n"
 	              "  l          List archive\n"
-	              "  e          Extract files to current directory\n",
+	              "  e          Extract files to current directory\n"
+	              "  t          Write files as a tar archive to stdout\n"
+	              "  h          Hash files, printing a manifest of their MD5 and CRC32 checksums\n",
 	              returnValue,
 	              makeEndArgs(&cmdOpt, &archiveOpt, &filesOpt));
 
+	parser.addSpace();
+	parser.addOption("jobs", 'j', "Extract or hash files using this many threads in parallel "
+	                 "(0: one per CPU core)", Common::CLI::kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+	parser.addOption("names", "Resolve hashed file names using this list of "
+	                 "additional file names, one per line", Common::CLI::kContinueParsing,
+	                 new ValGetter<Common::UString &>(names, "file"));
+
 	return parser.process(argv);
 }
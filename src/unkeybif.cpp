@@ -29,6 +29,8 @@
 #include <vector>
 #include <memory>
 
+#include <boost/unordered_map.hpp>
+
 #include "src/version/version.h"
 
 #include "src/common/util.h"
@@ -37,8 +39,12 @@
 #include "src/common/error.h"
 #include "src/common/platform.h"
 #include "src/common/readfile.h"
+#include "src/common/writefile.h"
+#include "src/common/mappedfile.h"
+#include "src/common/encoding.h"
 #include "src/common/filepath.h"
 #include "src/common/cli.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/util.h"
 #include "src/aurora/keyfile.h"
@@ -54,13 +60,21 @@ enum Command {
 	kCommandNone    = -1,
 	kCommandList    =  0,
 	kCommandExtract     ,
+	kCommandHash        ,
 	kCommandMAX
 };
 
-const char *kCommandChar[kCommandMAX] = { "l", "e" };
+const char *kCommandChar[kCommandMAX] = { "l", "e", "h" };
+
+/** Map of lowercased BIF/BZF names to the indices of all given data files with that name. */
+typedef boost::unordered_map<Common::UString, std::vector<size_t>, Common::hashUStringCaseSensitive> DataFileMap;
+
+static const uint32_t kCacheID      = MKTAG('K', 'B', 'I', 'X');
+static const uint32_t kCacheVersion = MKTAG('V', '1', '.', '0');
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, std::list<Common::UString> &files, Aurora::GameID &game);
+                      Command &command, std::list<Common::UString> &files, Aurora::GameID &game,
+                      uint32_t &jobs, Common::UString &cacheFile);
 
 uint32_t getFileID(const Common::UString &fileName);
 void identifyFiles(const std::list<Common::UString> &files, std::vector<Common::UString> &keyFiles,
@@ -72,8 +86,19 @@ void openKEYDataFiles(const std::vector<Common::UString> &dataFiles, std::vector
 void mergeKEYDataFiles(std::vector<std::unique_ptr<Aurora::KEYFile>> &keys, std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData,
                        const std::vector<Common::UString> &dataFiles);
 
+bool readIndexCache(const Common::UString &cacheFile, const std::list<Common::UString> &files,
+                    std::vector<Common::UString> &keyFiles, std::vector<Common::UString> &dataFiles,
+                    std::vector<std::unique_ptr<Aurora::KEYFile>> &keys,
+                    std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData);
+void writeIndexCache(const Common::UString &cacheFile, const std::list<Common::UString> &files,
+                     const std::vector<Common::UString> &keyFiles,
+                     const std::vector<std::unique_ptr<Aurora::KEYFile>> &keys,
+                     const std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData);
+
 void listFiles(const std::vector<std::unique_ptr<Aurora::KEYFile>> &keys, const std::vector<Common::UString> &keyFiles, Aurora::GameID game);
-void extractFiles(const std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData, const std::vector<Common::UString> &dataFiles, Aurora::GameID game);
+void extractFiles(const std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData, const std::vector<Common::UString> &dataFiles,
+                  Aurora::GameID game, uint32_t jobs);
+bool hashFiles(const std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData, Aurora::GameID game, uint32_t jobs);
 
 int main(int argc, char **argv) {
 	initPlatform();
@@ -87,25 +112,40 @@ int main(int argc, char **argv) {
 		int returnValue = 1;
 		Command command = kCommandNone;
 		std::list<Common::UString> files;
+		uint32_t jobs = 1;
+		Common::UString cacheFile;
 
-		if (!parseCommandLine(args, returnValue, command, files, game))
+		if (!parseCommandLine(args, returnValue, command, files, game, jobs, cacheFile))
 			return returnValue;
 
+		if (!cacheFile.empty())
+			cacheFile = Common::FilePath::absolutize(cacheFile);
+
 		std::vector<Common::UString> keyFiles, dataFiles;
-		identifyFiles(files, keyFiles, dataFiles);
 
 		std::vector<std::unique_ptr<Aurora::KEYFile>> keys;
 		std::vector<std::unique_ptr<Aurora::KEYDataFile>> keyData;
 
-		openKEYs(keyFiles, keys);
-		openKEYDataFiles(dataFiles, keyData);
+		if (cacheFile.empty() || !readIndexCache(cacheFile, files, keyFiles, dataFiles, keys, keyData)) {
+			identifyFiles(files, keyFiles, dataFiles);
+
+			openKEYs(keyFiles, keys);
+			openKEYDataFiles(dataFiles, keyData);
 
-		mergeKEYDataFiles(keys, keyData, dataFiles);
+			mergeKEYDataFiles(keys, keyData, dataFiles);
+
+			if (!cacheFile.empty())
+				writeIndexCache(cacheFile, files, keyFiles, keys, keyData);
+		}
 
 		if      (command == kCommandList)
 			listFiles(keys, keyFiles, game);
 		else if (command == kCommandExtract)
-			extractFiles(keyData, dataFiles, game);
+			extractFiles(keyData, dataFiles, game, jobs);
+		else if (command == kCommandHash) {
+			if (!hashFiles(keyData, game, jobs))
+				return 1;
+		}
 
 	} catch (...) {
 		Common::exceptionDispatcherError();
@@ -131,7 +171,8 @@ int ValGetter<Command &>::get(const std::vector<Common::UString> &args, int i, i
 }
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, std::list<Common::UString> &files, Aurora::GameID &game) {
+                      Command &command, std::list<Common::UString> &files, Aurora::GameID &game,
+                      uint32_t &jobs, Common::UString &cacheFile) {
 
 	using Common::CLI::NoOption;
 	using Common::CLI::Parser;
@@ -145,7 +186,9 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	Parser parser(argv[0], "BioWare KEY/BIF archive extractor",
 	              "Commands:\n"
 	              "  l          List files indexed in KEY archive(s)\n"
-	              "  e          Extract BIF archive(s). Needs KEY file(s) indexing these BIF.\n\n"
+	              "  e          Extract BIF archive(s). Needs KEY file(s) indexing these BIF.\n"
+	              "  h          Hash the files in BIF archive(s), printing a manifest of their\n"
+	              "             MD5 and CRC32 checksums. Needs KEY file(s) indexing these BIF.\n\n"
 	              "Examples:\n"
 	              "unkeybif l foo.key\n"
 	              "unkeybif l foo.key bar.key\n"
@@ -162,6 +205,14 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	                 Common::CLI::kContinueParsing,
 	                 makeAssigners(new ValAssigner<Aurora::GameID>(Aurora::kGameIDJade, game)));
 
+	parser.addSpace();
+	parser.addOption("jobs", 'j', "Extract or hash files using this many threads in parallel "
+	                 "(0: one per CPU core)", Common::CLI::kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+	parser.addOption("cache", "Keep the merged index of all given files in this cache file, "
+	                 "and reuse it while none of the files changed", Common::CLI::kContinueParsing,
+	                 new ValGetter<Common::UString &>(cacheFile, "file"));
+
 	return parser.process(argv);
 }
 
@@ -204,36 +255,159 @@ void openKEYDataFiles(const std::vector<Common::UString> &dataFiles, std::vector
 
 	for (const auto &dataFile : dataFiles) {
 		if (Common::FilePath::getExtension(dataFile).equalsIgnoreCase(".bzf"))
-			keyData.emplace_back(std::make_unique<Aurora::BZFFile>(new Common::ReadFile(dataFile)));
+			keyData.emplace_back(std::make_unique<Aurora::BZFFile>(new Common::MappedFile(dataFile)));
 		else
-			keyData.emplace_back(std::make_unique<Aurora::BIFFile>(new Common::ReadFile(dataFile)));
+			keyData.emplace_back(std::make_unique<Aurora::BIFFile>(new Common::MappedFile(dataFile)));
 	}
 }
 
 void mergeKEYDataFiles(std::vector<std::unique_ptr<Aurora::KEYFile>> &keys, std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData,
                        const std::vector<Common::UString> &dataFiles) {
 
+	// Map the lowercased stems of all given BIFs/BZFs to their indices
+	DataFileMap dataFileMap;
+	for (size_t dataFileIndex = 0; dataFileIndex < dataFiles.size(); dataFileIndex++)
+		dataFileMap[Common::FilePath::getStem(dataFiles[dataFileIndex]).toLower()].push_back(dataFileIndex);
+
 	// Go over all KEYs
 	for (auto &key : keys) {
 
 		// Go over all BIFs/BZFs handled by the KEY
 		const Aurora::KEYFile::BIFList &keyBifs = key->getBIFs();
 		for (size_t keyBIFIndex = 0; keyBIFIndex < keyBifs.size(); keyBIFIndex++) {
-			const Common::UString &keyBIF = keyBifs[keyBIFIndex];
+			DataFileMap::const_iterator dataFileIndices =
+				dataFileMap.find(Common::FilePath::getStem(keyBifs[keyBIFIndex]).toLower());
+
+			if (dataFileIndices == dataFileMap.end())
+				continue;
+
+			// Go over all given BIFs/BZFs matching this BIF
+			for (const auto &dataFileIndex : dataFileIndices->second)
+				keyData[dataFileIndex]->mergeKEY(*key, keyBIFIndex);
+		}
+
+	}
+
+}
+
+/** Read the merged index of all given files out of a cache file.
+ *
+ *  The cache is only used if it lists exactly the given files, in the same
+ *  order, and none of them changed in size or modification time since.
+ *
+ *  @return true if the index was read from the cache, false if the files
+ *          need to be read and merged again.
+ */
+bool readIndexCache(const Common::UString &cacheFile, const std::list<Common::UString> &files,
+                    std::vector<Common::UString> &keyFiles, std::vector<Common::UString> &dataFiles,
+                    std::vector<std::unique_ptr<Aurora::KEYFile>> &keys,
+                    std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData) {
+
+	if (!Common::FilePath::isRegularFile(cacheFile))
+		return false;
+
+	try {
+		Common::MappedFile cache(cacheFile);
+
+		if ((cache.readUint32BE() != kCacheID) || (cache.readUint32BE() != kCacheVersion))
+			return false;
+
+		if (cache.readUint32LE() != files.size())
+			return false;
+
+		std::vector<Common::UString> cachedKEYFiles, cachedDataFiles;
+
+		for (const auto &file : files) {
+			const Common::UString cachedFile = Common::readString(cache, Common::kEncodingUTF8);
 
-			// Go over all BIFs
-			for (size_t dataFileIndex = 0; dataFileIndex < dataFiles.size(); dataFileIndex++) {
-				const Common::UString &dataFileName = dataFiles[dataFileIndex];
-				Aurora::KEYDataFile &dataFile = *keyData[dataFileIndex];
+			const uint64_t size  = cache.readUint64LE();
+			const uint64_t mTime = cache.readUint64LE();
+			const bool     isKEY = cache.readByte() != 0;
 
-				if (Common::FilePath::getStem(keyBIF).equalsIgnoreCase(Common::FilePath::getStem(dataFileName)))
-					dataFile.mergeKEY(*key, keyBIFIndex);
-			}
+			if ((cachedFile != file) ||
+			    (size  != Common::FilePath::getFileSize(file)) ||
+			    (mTime != Common::FilePath::getModificationTime(file)))
+				return false;
 
+			if (isKEY)
+				cachedKEYFiles.push_back(file);
+			else
+				cachedDataFiles.push_back(file);
 		}
 
+		std::vector<std::unique_ptr<Aurora::KEYFile>> cachedKEYs;
+		std::vector<std::unique_ptr<Aurora::KEYDataFile>> cachedKEYData;
+
+		cachedKEYs.reserve(cachedKEYFiles.size());
+		for (size_t i = 0; i < cachedKEYFiles.size(); i++)
+			cachedKEYs.emplace_back(Aurora::KEYFile::readIndex(cache));
+
+		cachedKEYData.reserve(cachedDataFiles.size());
+		for (const auto &dataFile : cachedDataFiles) {
+			if (Common::FilePath::getExtension(dataFile).equalsIgnoreCase(".bzf"))
+				cachedKEYData.emplace_back(std::make_unique<Aurora::BZFFile>(new Common::MappedFile(dataFile), cache));
+			else
+				cachedKEYData.emplace_back(std::make_unique<Aurora::BIFFile>(new Common::MappedFile(dataFile), cache));
+		}
+
+		keyFiles.swap(cachedKEYFiles);
+		dataFiles.swap(cachedDataFiles);
+
+		keys.swap(cachedKEYs);
+		keyData.swap(cachedKEYData);
+
+	} catch (Common::Exception &e) {
+		e.add("Failed reading index cache \"%s\"", cacheFile.c_str());
+
+		Common::printException(e, "WARNING: ");
+		return false;
 	}
 
+	return true;
+}
+
+/** Write the merged index of all given files into a cache file. */
+void writeIndexCache(const Common::UString &cacheFile, const std::list<Common::UString> &files,
+                     const std::vector<Common::UString> &keyFiles,
+                     const std::vector<std::unique_ptr<Aurora::KEYFile>> &keys,
+                     const std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData) {
+
+	try {
+		Common::WriteFile cache(cacheFile);
+
+		cache.writeUint32BE(kCacheID);
+		cache.writeUint32BE(kCacheVersion);
+
+		cache.writeUint32LE(files.size());
+
+		// identifyFiles() keeps the order of the files, so we can tell them apart by walking both lists
+		size_t keyIndex = 0;
+		for (const auto &file : files) {
+			const bool isKEY = (keyIndex < keyFiles.size()) && (keyFiles[keyIndex] == file);
+			if (isKEY)
+				keyIndex++;
+
+			Common::writeString(cache, file, Common::kEncodingUTF8, true);
+
+			cache.writeUint64LE(Common::FilePath::getFileSize(file));
+			cache.writeUint64LE(Common::FilePath::getModificationTime(file));
+			cache.writeByte(isKEY ? 1 : 0);
+		}
+
+		for (const auto &key : keys)
+			key->writeIndex(cache);
+
+		for (const auto &data : keyData)
+			data->writeIndex(cache);
+
+		cache.flush();
+		cache.close();
+
+	} catch (Common::Exception &e) {
+		e.add("Failed writing index cache \"%s\"", cacheFile.c_str());
+
+		Common::printException(e, "WARNING: ");
+	}
 }
 
 void listFiles(const std::vector<std::unique_ptr<Aurora::KEYFile>> &keys,
@@ -248,16 +422,34 @@ void listFiles(const std::vector<std::unique_ptr<Aurora::KEYFile>> &keys,
 }
 
 void extractFiles(const std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData,
-                  const std::vector<Common::UString> &dataFiles, Aurora::GameID game) {
+                  const std::vector<Common::UString> &dataFiles, Aurora::GameID game, uint32_t jobs) {
+
+	// When extracting in parallel, all data files share one pool of workers
+	std::unique_ptr<Common::ThreadPool> pool;
+	if (jobs != 1)
+		pool = std::make_unique<Common::ThreadPool>(jobs);
 
 	for (size_t i = 0; i < keyData.size(); i++) {
 		std::printf("%s: %s indexed files (of %u)\n\n", dataFiles[i].c_str(),
 		            Common::composeString(keyData[i]->getResources().size()).c_str(),
                 keyData[i]->getInternalResourceCount());
 
-		Archives::extractFiles(*keyData[i], game, false, std::set<Common::UString>());
+		if (pool)
+			Archives::extractFiles(*keyData[i], game, *pool);
+		else
+			Archives::extractFiles(*keyData[i], game, false, std::set<Common::UString>(), 1);
 
 		if (i < (keyData.size() - 1))
 			std::printf("\n");
 	}
 }
+
+bool hashFiles(const std::vector<std::unique_ptr<Aurora::KEYDataFile>> &keyData, Aurora::GameID game, uint32_t jobs) {
+	bool success = true;
+
+	for (size_t i = 0; i < keyData.size(); i++)
+		if (!Archives::hashFiles(*keyData[i], game, false, std::set<Common::UString>(), jobs))
+			success = false;
+
+	return success;
+}
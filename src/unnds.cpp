@@ -32,7 +32,7 @@
 #include "src/common/ustring.h"
 #include "src/common/error.h"
 #include "src/common/platform.h"
-#include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
 #include "src/common/cli.h"
 
 #include "src/aurora/util.h"
@@ -47,13 +47,16 @@ enum Command {
 	kCommandInfo    =  0,
 	kCommandList        ,
 	kCommandExtract     ,
+	kCommandTar         ,
+	kCommandHash        ,
 	kCommandMAX
 };
 
-const char *kCommandChar[kCommandMAX] = { "i", "l", "e" };
+const char *kCommandChar[kCommandMAX] = { "i", "l", "e", "t", "h" };
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, Common::UString &archive, std::set<Common::UString> &files);
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
+                      uint32_t &jobs);
 
 void displayInfo(Aurora::NDSFile &nds);
 
@@ -68,11 +71,12 @@ int main(int argc, char **argv) {
 		Command command = kCommandNone;
 		Common::UString archive;
 		std::set<Common::UString> files;
+		uint32_t jobs = 1;
 
-		if (!parseCommandLine(args, returnValue, command, archive, files))
+		if (!parseCommandLine(args, returnValue, command, archive, files, jobs))
 			return returnValue;
 
-		Aurora::NDSFile nds(new Common::ReadFile(archive));
+		Aurora::NDSFile nds(new Common::MappedFile(archive));
 		files = Archives::fixPathSeparator(files);
 
 		if      (command == kCommandInfo)
@@ -80,7 +84,15 @@ int main(int argc, char **argv) {
 		else if (command == kCommandList)
 			Archives::listFiles(nds, Aurora::kGameIDUnknown, false);
 		else if (command == kCommandExtract)
-			Archives::extractFiles(nds, Aurora::kGameIDUnknown, false, files);
+			Archives::extractFiles(nds, Aurora::kGameIDUnknown, false, files, jobs);
+		else if (command == kCommandTar) {
+			if (!Archives::extractFilesTar(nds, Aurora::kGameIDUnknown, false, files))
+				return 1;
+		}
+		else if (command == kCommandHash) {
+			if (!Archives::hashFiles(nds, Aurora::kGameIDUnknown, false, files, jobs))
+				return 1;
+		}
 
 	} catch (...) {
 		Common::exceptionDispatcherError();
@@ -106,7 +118,8 @@ int ValGetter<Command &>::get(const std::vector<Common::UString> &args, int i, i
 }
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, Common::UString &archive, std::set<Common::UString> &files) {
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
+                      uint32_t &jobs) {
 
 	using Common::CLI::NoOption;
 	using Common::CLI::Parser;
@@ -120,10 +133,17 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	              "Commands:\n"
 	              "  i          Display meta-information\n"
 	              "  l          List archive\n"
-	              "  e          Extract files to current directory\n",
+	              "  e          Extract files to current directory\n"
+	              "  t          Write files as a tar archive to stdout\n"
+	              "  h          Hash files, printing a manifest of their MD5 and CRC32 checksums\n",
 	              returnValue,
 	              makeEndArgs(&cmdOpt, &archiveOpt, &filesOpt));
 
+	parser.addSpace();
+	parser.addOption("jobs", 'j', "Extract or hash files using this many threads in parallel "
+	                 "(0: one per CPU core)", Common::CLI::kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+
 	return parser.process(argv);
 }
 
@@ -33,7 +33,7 @@
 #include "src/common/error.h"
 #include "src/common/platform.h"
 #include "src/common/cli.h"
-#include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
 
 #include "src/aurora/obbfile.h"
 #include "src/aurora/zipfile.h"
@@ -48,13 +48,16 @@ enum Command {
 	kCommandListVerbose     ,
 	kCommandExtract         ,
 	kCommandExtractDir      ,
+	kCommandTar             ,
+	kCommandHash            ,
 	kCommandMAX
 };
 
-const char *kCommandChar[kCommandMAX] = { "l", "v", "e", "x" };
+const char *kCommandChar[kCommandMAX] = { "l", "v", "e", "x", "t", "h" };
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, Common::UString &archive, std::set<Common::UString> &files);
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
+                      uint32_t &jobs);
 
 bool isPKZIP(Common::SeekableReadStream &stream);
 
@@ -69,11 +72,12 @@ int main(int argc, char **argv) {
 		Command command = kCommandNone;
 		Common::UString archive;
 		std::set<Common::UString> files;
+		uint32_t jobs = 1;
 
-		if (!parseCommandLine(args, returnValue, command, archive, files))
+		if (!parseCommandLine(args, returnValue, command, archive, files, jobs))
 			return returnValue;
 
-		std::unique_ptr<Common::SeekableReadStream> stream = std::make_unique<Common::ReadFile>(archive);
+		std::unique_ptr<Common::SeekableReadStream> stream = std::make_unique<Common::MappedFile>(archive);
 
 		std::unique_ptr<Aurora::Archive> arc;
 		if (isPKZIP(*stream))
@@ -88,9 +92,17 @@ int main(int argc, char **argv) {
 		else if (command == kCommandListVerbose)
 			Archives::listFiles(*arc, Aurora::kGameIDUnknown, true);
 		else if (command == kCommandExtract)
-			Archives::extractFiles(*arc, Aurora::kGameIDUnknown, false, files);
+			Archives::extractFiles(*arc, Aurora::kGameIDUnknown, false, files, jobs);
 		else if (command == kCommandExtractDir)
-			Archives::extractFiles(*arc, Aurora::kGameIDUnknown, true, files);
+			Archives::extractFiles(*arc, Aurora::kGameIDUnknown, true, files, jobs);
+		else if (command == kCommandTar) {
+			if (!Archives::extractFilesTar(*arc, Aurora::kGameIDUnknown, true, files))
+				return 1;
+		}
+		else if (command == kCommandHash) {
+			if (!Archives::hashFiles(*arc, Aurora::kGameIDUnknown, true, files, jobs))
+				return 1;
+		}
 
 	} catch (...) {
 		Common::exceptionDispatcherError();
@@ -116,7 +128,8 @@ int ValGetter<Command &>::get(const std::vector<Common::UString> &args, int i, i
 }
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
-                      Command &command, Common::UString &archive, std::set<Common::UString> &files) {
+                      Command &command, Common::UString &archive, std::set<Common::UString> &files,
+                      uint32_t &jobs) {
 
 	using Common::CLI::NoOption;
 	using Common::CLI::Parser;
@@ -131,10 +144,17 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	              "  l          List files (stripping directories)\n"
 	              "  v          List files verbosely (with directories)\n"
 	              "  e          Extract files to current directory, stripping directories\n"
-	              "  x          Extract files to current directory, creating subdirectories\n",
+	              "  x          Extract files to current directory, creating subdirectories\n"
+	              "  t          Write files as a tar archive to stdout, with subdirectories\n"
+	              "  h          Hash files, printing a manifest of their MD5 and CRC32 checksums\n",
 	              returnValue,
 	              makeEndArgs(&cmdOpt, &archiveOpt, &filesOpt));
 
+	parser.addSpace();
+	parser.addOption("jobs", 'j', "Extract or hash files using this many threads in parallel "
+	                 "(0: one per CPU core)", Common::CLI::kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+
 	return parser.process(argv);
 }
 
@@ -29,7 +29,7 @@
 #include "src/common/ustring.h"
 #include "src/common/error.h"
 #include "src/common/platform.h"
-#include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
 #include "src/common/cli.h"
 
 #include "src/aurora/util.h"
@@ -43,14 +43,17 @@ enum Command {
 	kCommandNone    = -1,
 	kCommandList    =  0,
 	kCommandExtract     ,
+	kCommandTar         ,
+	kCommandHash        ,
 	kCommandMAX
 };
 
-const char *kCommandChar[kCommandMAX] = { "l", "e" };
+const char *kCommandChar[kCommandMAX] = { "l", "e", "t", "h" };
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
                       Command &command, Common::UString &archive,
-                      Aurora::GameID &game, std::set<Common::UString> &files);
+                      Aurora::GameID &game, std::set<Common::UString> &files,
+                      uint32_t &jobs);
 
 int main(int argc, char **argv) {
 	initPlatform();
@@ -65,17 +68,26 @@ int main(int argc, char **argv) {
 		Command command = kCommandNone;
 		Common::UString archive;
 		std::set<Common::UString> files;
+		uint32_t jobs = 1;
 
-		if (!parseCommandLine(args, returnValue, command, archive, game, files))
+		if (!parseCommandLine(args, returnValue, command, archive, game, files, jobs))
 			return returnValue;
 
-		Aurora::RIMFile rim(new Common::ReadFile(archive));
+		Aurora::RIMFile rim(new Common::MappedFile(archive));
 		files = Archives::fixPathSeparator(files);
 
 		if      (command == kCommandList)
 			Archives::listFiles(rim, game, false);
 		else if (command == kCommandExtract)
-			Archives::extractFiles(rim, game, false, files);
+			Archives::extractFiles(rim, game, false, files, jobs);
+		else if (command == kCommandTar) {
+			if (!Archives::extractFilesTar(rim, game, false, files))
+				return 1;
+		}
+		else if (command == kCommandHash) {
+			if (!Archives::hashFiles(rim, game, false, files, jobs))
+				return 1;
+		}
 
 	} catch (...) {
 		Common::exceptionDispatcherError();
@@ -102,7 +114,8 @@ int ValGetter<Command &>::get(const std::vector<Common::UString> &args, int i, i
 
 bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue,
                       Command &command, Common::UString &archive,
-                      Aurora::GameID &game, std::set<Common::UString> &files) {
+                      Aurora::GameID &game, std::set<Common::UString> &files,
+                      uint32_t &jobs) {
 
 	using Common::CLI::NoOption;
 	using Common::CLI::kContinueParsing;
@@ -118,7 +131,9 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	Parser parser(argv[0], "BioWare RIM archive extractor",
 	              "Commands:\n"
 	              "  l          List archive\n"
-	              "  e          Extract files to current directory\n",
+	              "  e          Extract files to current directory\n"
+	              "  t          Write files as a tar archive to stdout\n"
+	              "  h          Hash files, printing a manifest of their MD5 and CRC32 checksums\n",
 	              returnValue,
 	              makeEndArgs(&cmdOpt, &archiveOpt, &filesOpt));
 
@@ -130,5 +145,10 @@ bool parseCommandLine(const std::vector<Common::UString> &argv, int &returnValue
 	                 kContinueParsing,
 	                 makeAssigners(new ValAssigner<Aurora::GameID>(Aurora::kGameIDJade, game)));
 
+	parser.addSpace();
+	parser.addOption("jobs", 'j', "Extract or hash files using this many threads in parallel "
+	                 "(0: one per CPU core)", kContinueParsing,
+	                 new ValGetter<uint32_t &>(jobs, "n"));
+
 	return parser.process(argv);
 }
@@ -22,6 +22,8 @@
  *  Creates V3.2 GFFs out of XML files.
  */
 
+#include <vector>
+
 #include "src/common/strutil.h"
 #include "src/common/base64.h"
 
@@ -29,198 +31,169 @@
 
 namespace XML {
 
-void GFF3Creator::create(const XML::XMLNode &root, uint32_t id, Common::WriteStream &file, uint32_t version) {
-	Aurora::GFF3Writer gff3(id, version);
+/** Read the text content of the current element as a value. */
+template<typename T>
+static T readValue(XMLReader &xml) {
+	T value;
+	Common::parseString(xml.readElementText(), value);
 
-	if (root.getChildren().size() > 1)
-		throw Common::Exception("GFF3Creator::create() More than one root struct");
+	return value;
+}
 
-	if (root.getChildren().size() == 0)
-		throw Common::Exception("GFF3Creator::create() No root struct");
+/** Read the text contents of all child elements of the current element. */
+static void readComponents(XMLReader &xml, std::vector<Common::UString> &components) {
+	while (xml.readNextStartElement())
+		components.push_back(xml.readElementText());
+}
 
-	const XML::XMLNode &rootStruct = *root.getChildren().front();
+void GFF3Creator::create(XML::XMLReader &xml, uint32_t id, Common::WriteStream &file, uint32_t version) {
+	Aurora::GFF3Writer gff3(id, version);
+
+	if (!xml.readNextStartElement())
+		throw Common::Exception("GFF3Creator::create() No root struct");
 
-	Common::parseString(rootStruct.getProperty("id"), id);
+	Common::parseString(xml.getProperty("id"), id);
 	if (id != 0xFFFFFFFF)
 		throw Common::Exception("GFF3Creator::create() Invalid root struct id");
 
-	readStructContents(rootStruct.getChildren(), gff3.getTopLevel());
+	readStructContents(xml, gff3.getTopLevel());
+
+	if (xml.readNextStartElement())
+		throw Common::Exception("GFF3Creator::create() More than one root struct");
 
 	gff3.write(file);
 }
 
-void GFF3Creator::readStructContents(const XMLNode::Children &strctNodes, Aurora::GFF3WriterStructPtr strctPtr) {
-	for (const auto &strctNode : strctNodes) {
-		if (strctNode->getName() == "byte") {
-			uint8_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addByte(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "char") {
-			int8_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addChar(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "sint16") {
-			int16_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addSint16(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "float") {
-			float value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addFloat(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "float") {
-			double value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addDouble(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "sint32") {
-			int32_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addSint32(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "sint64") {
-			int64_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addSint64(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "uint16_t") {
-			uint16_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addUint16(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "uint32_t") {
-			uint32_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addUint32(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "uint64_t") {
-			uint64_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addUint64(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "exostring") {
-			const XMLNode *text = strctNode->findChild("text");
-			if (text) {
-				bool base64 = false;
-				Common::parseString(strctNode->getProperty("base64"), base64, true);
-
-				const Common::UString contents = text->getContent();
-				if (base64) {
-					Common::SeekableReadStream *debase64 = Common::decodeBase64(contents);
-					strctPtr->addExoString(strctNode->getProperty("label"), debase64);
-
-				} else
-					strctPtr->addExoString(strctNode->getProperty("label"), contents);
+void GFF3Creator::readStructContents(XMLReader &xml, Aurora::GFF3WriterStructPtr strctPtr) {
+	while (xml.readNextStartElement()) {
+		const Common::UString name  = xml.getName();
+		const Common::UString label = xml.getProperty("label");
+
+		if (name == "byte") {
+			strctPtr->addByte(label, readValue<uint8_t>(xml));
+		} else if (name == "char") {
+			strctPtr->addChar(label, readValue<int8_t>(xml));
+		} else if (name == "sint16") {
+			strctPtr->addSint16(label, readValue<int16_t>(xml));
+		} else if (name == "float") {
+			strctPtr->addFloat(label, readValue<float>(xml));
+		} else if (name == "sint32") {
+			strctPtr->addSint32(label, readValue<int32_t>(xml));
+		} else if (name == "sint64") {
+			strctPtr->addSint64(label, readValue<int64_t>(xml));
+		} else if (name == "uint16_t") {
+			strctPtr->addUint16(label, readValue<uint16_t>(xml));
+		} else if (name == "uint32_t") {
+			strctPtr->addUint32(label, readValue<uint32_t>(xml));
+		} else if (name == "uint64_t") {
+			strctPtr->addUint64(label, readValue<uint64_t>(xml));
+		} else if (name == "exostring") {
+			bool base64 = false;
+			Common::parseString(xml.getProperty("base64"), base64, true);
+
+			const Common::UString contents = xml.readElementText();
+			if (base64 && !contents.empty()) {
+				Common::SeekableReadStream *debase64 = Common::decodeBase64(contents);
+				strctPtr->addExoString(label, debase64);
 
 			} else
-				strctPtr->addExoString(strctNode->getProperty("label"), "");
-
-		} else if (strctNode->getName() == "strref") {
-			uint32_t value;
-			Common::parseString(strctNode->findChild("text")->getContent(), value);
-			strctPtr->addStrRef(strctNode->getProperty("label"), value);
-		} else if (strctNode->getName() == "resref") {
-			const XMLNode *text = strctNode->findChild("text");
-			if (text) {
-				bool base64 = false;
-				Common::parseString(strctNode->getProperty("base64"), base64, true);
-
-				const Common::UString contents = text->getContent();
-				if (base64) {
-					Common::SeekableReadStream *debase64 = Common::decodeBase64(contents);
-					strctPtr->addResRef(strctNode->getProperty("label"), debase64);
-
-				} else
-					strctPtr->addResRef(strctNode->getProperty("label"), contents);
+				strctPtr->addExoString(label, contents);
 
-			} else
-				strctPtr->addResRef(strctNode->getProperty("label"), "");
+		} else if (name == "strref") {
+			strctPtr->addStrRef(label, readValue<uint32_t>(xml));
+		} else if (name == "resref") {
+			bool base64 = false;
+			Common::parseString(xml.getProperty("base64"), base64, true);
+
+			const Common::UString contents = xml.readElementText();
+			if (base64 && !contents.empty()) {
+				Common::SeekableReadStream *debase64 = Common::decodeBase64(contents);
+				strctPtr->addResRef(label, debase64);
 
-		} else if (strctNode->getName() == "data") {
-			const XMLNode *textNode = strctNode->findChild("text");
-			Common::UString text = textNode ? textNode->getContent() : "";
+			} else
+				strctPtr->addResRef(label, contents);
 
-			Common::SeekableReadStream *debase64 = Common::decodeBase64(text);
-			strctPtr->addVoid(strctNode->getProperty("label"), debase64);
-		} else if (strctNode->getName() == "vector") {
+		} else if (name == "data") {
+			Common::SeekableReadStream *debase64 = Common::decodeBase64(xml.readElementText());
+			strctPtr->addVoid(label, debase64);
+		} else if (name == "vector") {
 			float x, y, z;
 
-			if (strctNode->getChildren().size() != 3)
-				throw Common::Exception("GFF3Creator::readStructContents() Invalid size of vector components");
+			std::vector<Common::UString> components;
+			readComponents(xml, components);
 
-			XMLNode::Children::const_iterator iter = strctNode->getChildren().begin();
-			const XMLNode *xValue = (*iter++)->findChild("text");
-			const XMLNode *yValue = (*iter++)->findChild("text");
-			const XMLNode *zValue = (*iter++)->findChild("text");
+			if (components.size() != 3)
+				throw Common::Exception("GFF3Creator::readStructContents() Invalid size of vector components");
 
-			if (!xValue || !yValue || !zValue)
+			if (components[0].empty() || components[1].empty() || components[2].empty())
 				throw Common::Exception("GFF3Creator::readStructContents() Vector components empty");
 
-			Common::parseString(xValue->getContent(), x);
-			Common::parseString(yValue->getContent(), y);
-			Common::parseString(zValue->getContent(), z);
+			Common::parseString(components[0], x);
+			Common::parseString(components[1], y);
+			Common::parseString(components[2], z);
 
-			strctPtr->addVector(strctNode->getProperty("label"), x, y, z);
-		} else if (strctNode->getName() == "orientation") {
+			strctPtr->addVector(label, x, y, z);
+		} else if (name == "orientation") {
 			float x, y, z, w;
 
-			if (strctNode->getChildren().size() != 4)
-				throw Common::Exception("GFF3Creator::readStructContents() Invalid size of orientation components");
+			std::vector<Common::UString> components;
+			readComponents(xml, components);
 
-			XMLNode::Children::const_iterator iter = strctNode->getChildren().begin();
-			const XMLNode *xValue = (*iter++)->findChild("text");
-			const XMLNode *yValue = (*iter++)->findChild("text");
-			const XMLNode *zValue = (*iter++)->findChild("text");
-			const XMLNode *wValue = (*iter++)->findChild("text");
+			if (components.size() != 4)
+				throw Common::Exception("GFF3Creator::readStructContents() Invalid size of orientation components");
 
-			if (!xValue || !yValue || !zValue)
+			if (components[0].empty() || components[1].empty() || components[2].empty() || components[3].empty())
 				throw Common::Exception("GFF3Creator::readStructContents() Orientation components empty");
 
-			Common::parseString(xValue->getContent(), x);
-			Common::parseString(yValue->getContent(), y);
-			Common::parseString(zValue->getContent(), z);
-			Common::parseString(wValue->getContent(), w);
+			Common::parseString(components[0], x);
+			Common::parseString(components[1], y);
+			Common::parseString(components[2], z);
+			Common::parseString(components[3], w);
 
-			strctPtr->addOrientation(strctNode->getProperty("label"), x, y, z, w);
-		} else if (strctNode->getName() == "locstring") {
+			strctPtr->addOrientation(label, x, y, z, w);
+		} else if (name == "locstring") {
 			uint32_t strref;
 			Aurora::LocString locString;
 
-			Common::parseString(strctNode->getProperty("strref"), strref);
+			Common::parseString(xml.getProperty("strref"), strref);
 			locString.setID(strref);
 
-			if (!strctNode->getChildren().empty()) {
-				for (const auto &child : strctNode->getChildren()) {
-					if (child->getName() != "string")
-						throw Common::Exception("GFF3Creator::readStructContents() Invalid LocString string");
-
-					const XMLNode *text = child->findChild("text");
+			while (xml.readNextStartElement()) {
+				if (xml.getName() != "string")
+					throw Common::Exception("GFF3Creator::readStructContents() Invalid LocString string");
 
-					uint32_t id;
-					Common::parseString(child->getProperty("language"), id);
-					locString.setStringRawLanguageID(id, text ? text->getContent() : "");
-				}
+				uint32_t id;
+				Common::parseString(xml.getProperty("language"), id);
+				locString.setStringRawLanguageID(id, xml.readElementText());
 			}
 
-			strctPtr->addLocString(strctNode->getProperty("label"), locString);
-		} else if (strctNode->getName() == "struct") {
-			Common::UString idText = strctNode->getProperty("id");
+			strctPtr->addLocString(label, locString);
+		} else if (name == "struct") {
+			Common::UString idText = xml.getProperty("id");
 
 			Aurora::GFF3WriterStructPtr strct = nullptr;
 			if (!idText.empty()) {
 				uint32_t id;
 				Common::parseString(idText, id);
-				strct = strctPtr->addStruct(strctNode->getProperty("label"), id);
+				strct = strctPtr->addStruct(label, id);
 			} else
-				strct = strctPtr->addStruct(strctNode->getProperty("label"));
+				strct = strctPtr->addStruct(label);
 
-			readStructContents(strctNode->getChildren(), strct);
-		} else if (strctNode->getName() == "list") {
-			Aurora::GFF3WriterListPtr list = strctPtr->addList(strctNode->getProperty("label"));
-			readListContents(strctNode->getChildren(), list);
-		}
+			readStructContents(xml, strct);
+		} else if (name == "list") {
+			Aurora::GFF3WriterListPtr list = strctPtr->addList(label);
+			readListContents(xml, list);
+		} else
+			xml.skipCurrentElement();
 	}
 }
 
-void GFF3Creator::readListContents(const XMLNode::Children &listNodes, Aurora::GFF3WriterListPtr listPtr) {
-	for (const auto &node : listNodes) {
-		if (node->getName() != "struct")
+void GFF3Creator::readListContents(XMLReader &xml, Aurora::GFF3WriterListPtr listPtr) {
+	while (xml.readNextStartElement()) {
+		if (xml.getName() != "struct")
 			throw Common::Exception("GFF3Creator::readListContents() Invalid element in list");
 
-		Common::UString idText = node->getProperty("id");
+		Common::UString idText = xml.getProperty("id");
 
 		Aurora::GFF3WriterStructPtr strct = nullptr;
 		if (!idText.empty()) {
@@ -230,7 +203,7 @@ void GFF3Creator::readListContents(const XMLNode::Children &listNodes, Aurora::G
 		} else
 			strct = listPtr->addStruct();
 
-		readStructContents(node->getChildren(), strct);
+		readStructContents(xml, strct);
 	}
 }
 
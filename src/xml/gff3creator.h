@@ -35,11 +35,12 @@ namespace XML {
 
 class GFF3Creator {
 public:
-	static void create(const XML::XMLNode &root, uint32_t id, Common::WriteStream &file, uint32_t version);
+	/** Create a GFF3 out of the XML, with the reader positioned on the root element. */
+	static void create(XML::XMLReader &xml, uint32_t id, Common::WriteStream &file, uint32_t version);
 
 private:
-	static void readStructContents(const XMLNode::Children &strctNodes, Aurora::GFF3WriterStructPtr strctPtr);
-	static void readListContents(const XMLNode::Children &listNodes, Aurora::GFF3WriterListPtr listPtr);
+	static void readStructContents(XMLReader &xml, Aurora::GFF3WriterStructPtr strctPtr);
+	static void readListContents(XMLReader &xml, Aurora::GFF3WriterListPtr listPtr);
 };
 
 } // End of namespace XML
@@ -28,6 +28,7 @@
 
 #include <libxml/parser.h>
 #include <libxml/xmlerror.h>
+#include <libxml/xmlreader.h>
 
 #include <boost/scope_exit.hpp>
 
@@ -185,4 +186,210 @@ void XMLNode::load(_xmlNode &node, bool makeLower) {
 	}
 }
 
+
+
+XMLReader::XMLReader(Common::ReadStream &stream, bool makeLower, const Common::UString &fileName) :
+	_reader(0), _makeLower(makeLower), _depth(0), _isEmpty(false), _atStart(false) {
+
+	initXML();
+
+	xmlSetGenericErrorFunc(static_cast<void *>(&_parseError), errorFuncUString);
+
+	const int options = XML_PARSE_NOWARNING | XML_PARSE_NOBLANKS | XML_PARSE_NONET |
+	                    XML_PARSE_NSCLEAN   | XML_PARSE_NOCDATA;
+
+	_reader = xmlReaderForIO(readStream, closeStream, static_cast<void *>(&stream),
+	                         fileName.c_str(), 0, options);
+
+	try {
+		if (!_reader)
+			throw Common::Exception("Failed to create XML reader");
+
+		// Position ourselves on the root element
+		while (read()) {
+			if (xmlTextReaderNodeType(_reader) == XML_READER_TYPE_ELEMENT) {
+				readElement();
+				return;
+			}
+		}
+
+		throw Common::Exception("XML document has no root node");
+
+	} catch (...) {
+		close();
+		throw;
+	}
+}
+
+XMLReader::~XMLReader() {
+	close();
+}
+
+void XMLReader::close() {
+	if (_reader)
+		xmlFreeTextReader(_reader);
+
+	_reader = 0;
+
+	xmlSetGenericErrorFunc(0, 0);
+	deinitXML();
+}
+
+const Common::UString &XMLReader::getName() const {
+	return _name;
+}
+
+const XMLReader::Properties &XMLReader::getProperties() const {
+	return _properties;
+}
+
+Common::UString XMLReader::getProperty(const Common::UString &name, const Common::UString &def) const {
+	Properties::const_iterator property = _properties.find(name);
+	if (property != _properties.end())
+		return property->second;
+
+	return def;
+}
+
+bool XMLReader::readNextStartElement() {
+	if (_atStart) {
+		// Step into the current element, which has no children if it's empty
+		_atStart = false;
+
+		if (_isEmpty) {
+			endElement(_depth);
+			return false;
+		}
+	}
+
+	while (read()) {
+		const int type = xmlTextReaderNodeType(_reader);
+
+		if (type == XML_READER_TYPE_ELEMENT) {
+			readElement();
+			return true;
+		}
+
+		if (type == XML_READER_TYPE_END_ELEMENT) {
+			endElement(xmlTextReaderDepth(_reader));
+			return false;
+		}
+	}
+
+	return false;
+}
+
+Common::UString XMLReader::readElementText() {
+	Common::UString text;
+	readToEndElement(&text);
+
+	return text;
+}
+
+void XMLReader::skipCurrentElement() {
+	readToEndElement(0);
+}
+
+bool XMLReader::read() {
+	const int result = xmlTextReaderRead(_reader);
+	if (result == 1)
+		return true;
+	if (result == 0)
+		return false;
+
+	Common::Exception e;
+
+	if (!_parseError.empty())
+		e.add("%s", _parseError.c_str());
+
+	e.add("XML document failed to parse");
+	throw e;
+}
+
+void XMLReader::readElement() {
+	const xmlChar *name = xmlTextReaderConstLocalName(_reader);
+
+	_name = name ? reinterpret_cast<const char *>(name) : "";
+	if (_makeLower)
+		_name.makeLower();
+
+	_depth   = xmlTextReaderDepth(_reader);
+	_isEmpty = xmlTextReaderIsEmptyElement(_reader) == 1;
+	_atStart = true;
+
+	_properties.clear();
+	while (xmlTextReaderMoveToNextAttribute(_reader) == 1) {
+		// Namespace declarations are not properties
+		if (xmlTextReaderIsNamespaceDecl(_reader) == 1)
+			continue;
+
+		const xmlChar *attribName  = xmlTextReaderConstLocalName(_reader);
+		const xmlChar *attribValue = xmlTextReaderConstValue(_reader);
+
+		Common::UString propName (attribName  ? reinterpret_cast<const char *>(attribName)  : "");
+		Common::UString propValue(attribValue ? reinterpret_cast<const char *>(attribValue) : "");
+
+		if (_makeLower)
+			propName.makeLower();
+
+		_properties.insert(std::make_pair(propName, propValue));
+	}
+
+	xmlTextReaderMoveToElement(_reader);
+}
+
+void XMLReader::readToEndElement(Common::UString *text) {
+	if (_atStart) {
+		_atStart = false;
+
+		if (_isEmpty) {
+			endElement(_depth);
+			return;
+		}
+	}
+
+	// Nesting depth of child elements we're skipping
+	size_t depth = 0;
+
+	while (read()) {
+		switch (xmlTextReaderNodeType(_reader)) {
+			case XML_READER_TYPE_TEXT:
+			case XML_READER_TYPE_CDATA:
+			case XML_READER_TYPE_SIGNIFICANT_WHITESPACE:
+				if (text && (depth == 0)) {
+					const xmlChar *value = xmlTextReaderConstValue(_reader);
+					if (value)
+						*text += reinterpret_cast<const char *>(value);
+				}
+				break;
+
+			case XML_READER_TYPE_ELEMENT:
+				if (xmlTextReaderIsEmptyElement(_reader) != 1)
+					depth++;
+				break;
+
+			case XML_READER_TYPE_END_ELEMENT:
+				if (depth == 0) {
+					endElement(xmlTextReaderDepth(_reader));
+					return;
+				}
+
+				depth--;
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+void XMLReader::endElement(int depth) {
+	if (depth > 0)
+		return;
+
+	// The root element ended. Read the rest of the document, to find any errors there
+	while (read())
+		;
+}
+
 } // End of namespace XML
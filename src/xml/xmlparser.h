@@ -34,6 +34,7 @@
 #include "src/common/ustring.h"
 
 struct _xmlNode;
+struct _xmlTextReader;
 
 namespace Common {
 	class ReadStream;
@@ -110,6 +111,103 @@ private:
 	friend class XMLParser;
 };
 
+/** Class to read the elements of an XML stream one by one, without building a tree.
+ *
+ *  Unlike XMLParser, which reads the whole document into memory at once,
+ *  XMLReader only ever holds the element it is currently positioned on.
+ *  This keeps the memory needed to read an XML document bounded by how
+ *  deeply its elements are nested, instead of by the size of the document.
+ *
+ *  After construction, the reader is positioned on the root element. The
+ *  children of the current element are then walked with readNextStartElement():
+ *
+ *  @code
+ *  while (xml.readNextStartElement()) {
+ *  	if (xml.getName() == "value")
+ *  		values.push_back(xml.readElementText());
+ *  	else
+ *  		xml.skipCurrentElement();
+ *  }
+ *  @endcode
+ *
+ *  Every element found by readNextStartElement() has to be consumed before
+ *  the next call, either by walking its children with readNextStartElement()
+ *  until it returns false, by readElementText() or by skipCurrentElement().
+ *
+ *  Once the end of the root element is reached, the rest of the document is
+ *  read as well, so that errors in it are found before the caller is done.
+ */
+class XMLReader : boost::noncopyable {
+public:
+	typedef std::map<Common::UString, Common::UString> Properties;
+
+	/** Start reading an XML file out of a stream.
+	 *
+	 *  @param stream The stream to read the XML from.
+	 *  @param makeLower Should all tags be converted to lowercase, to ease case-insensitive comparison?
+	 *  @param fileName The file name to tell libxml2. Only used for error reporting.
+	 */
+	XMLReader(Common::ReadStream &stream, bool makeLower = false,
+	          const Common::UString &fileName = "stream.xml");
+	~XMLReader();
+
+	/** Return the name of the current element. */
+	const Common::UString &getName() const;
+
+	/** Return all the properties on the current element. */
+	const Properties &getProperties() const;
+	/** Return a certain property on the current element. */
+	Common::UString getProperty(const Common::UString &name, const Common::UString &def = "") const;
+
+	/** Read until the next start element within the current element.
+	 *
+	 *  @return true if a start element was found, which is now the current element.
+	 *          false if the end of the current element was reached instead.
+	 */
+	bool readNextStartElement();
+
+	/** Read the text content of the current element, up to and including its end.
+	 *
+	 *  Any child elements are skipped.
+	 */
+	Common::UString readElementText();
+
+	/** Skip the rest of the current element, including all of its children. */
+	void skipCurrentElement();
+
+private:
+	_xmlTextReader *_reader;
+
+	bool _makeLower;
+
+	/** Collected error messages of libxml2. */
+	Common::UString _parseError;
+
+	Common::UString _name;
+	Properties _properties;
+
+	/** The depth of the current element within the document. */
+	int _depth;
+
+	/** Is the current element empty, i.e. <element/>? */
+	bool _isEmpty;
+	/** Are we positioned on the start of the current element? */
+	bool _atStart;
+
+
+	/** Read the next node. Return false at the end of the document. */
+	bool read();
+	/** Read the current node as the current element. */
+	void readElement();
+
+	/** Read up to and including the end of the current element, collecting its text if wanted. */
+	void readToEndElement(Common::UString *text);
+	/** The element at this depth ended. */
+	void endElement(int depth);
+
+	void close();
+};
+
 } // End of namespace XML
 
 #endif // XML_XMLPARSER_H
@@ -0,0 +1,58 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our Sonic file name resolver.
+ */
+
+#include "gtest/gtest.h"
+
+#include "src/common/hash.h"
+
+#include "src/archives/files_sonic.h"
+
+GTEST_TEST(FilesSonic, findSonicFile) {
+	const char *name1 = Archives::findSonicFile(UINT32_C(0x00021EC9));
+	ASSERT_NE(name1, static_cast<const char *>(0));
+	EXPECT_STREQ(name1, "prtl_gglgen_1.ncgr.small");
+
+	const char *name2 = Archives::findSonicFile(UINT32_C(0xFFB0DD6D));
+	ASSERT_NE(name2, static_cast<const char *>(0));
+	EXPECT_STREQ(name2, "classes.gda");
+
+	const char *name3 = Archives::findSonicFile(UINT32_C(0xFFFA7BF3));
+	ASSERT_NE(name3, static_cast<const char *>(0));
+	EXPECT_STREQ(name3, "man_tdlcp_on01.ncgr.small");
+
+	EXPECT_EQ(Archives::findSonicFile(UINT32_C(0x00000000)), static_cast<const char *>(0));
+	EXPECT_EQ(Archives::findSonicFile(UINT32_C(0xFFFFFFFF)), static_cast<const char *>(0));
+}
+
+GTEST_TEST(FilesSonic, findSonicFileAlgo) {
+	const uint64_t hash = Common::hashString("classes.gda", Common::kHashDJB2);
+
+	const char *name = Archives::findSonicFile(hash, Common::kHashDJB2);
+	ASSERT_NE(name, static_cast<const char *>(0));
+	EXPECT_STREQ(name, "classes.gda");
+
+	EXPECT_EQ(Archives::findSonicFile(hash, Common::kHashFNV32), static_cast<const char *>(0));
+	EXPECT_EQ(Archives::findSonicFile(hash | UINT64_C(0x100000000), Common::kHashDJB2),
+	          static_cast<const char *>(0));
+}
@@ -0,0 +1,113 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our dictionary of user-supplied file names.
+ */
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "src/common/hash.h"
+#include "src/common/memreadstream.h"
+
+#include "src/archives/namedictionary.h"
+
+static const char *kNames =
+	"# A comment\n"
+	"foo.txt\n"
+	"\n"
+	"  Data/Bar.gda  \r\n"
+	"quux.2da";
+
+GTEST_TEST(NameDictionary, add) {
+	Archives::NameDictionary dict;
+
+	dict.add("foo.txt");
+	dict.add("bar.gda");
+	EXPECT_EQ(dict.size(), 2);
+
+	for (int algo = 0; algo < Common::kHashMAX; algo++) {
+		const Common::HashAlgo hashAlgo = (Common::HashAlgo) algo;
+
+		const char *name1 = dict.find(Common::hashString("foo.txt", hashAlgo), hashAlgo);
+		ASSERT_NE(name1, static_cast<const char *>(0)) << "At algo " << algo;
+		EXPECT_STREQ(name1, "foo.txt") << "At algo " << algo;
+
+		const char *name2 = dict.find(Common::hashString("bar.gda", hashAlgo), hashAlgo);
+		ASSERT_NE(name2, static_cast<const char *>(0)) << "At algo " << algo;
+		EXPECT_STREQ(name2, "bar.gda") << "At algo " << algo;
+
+		EXPECT_EQ(dict.find(Common::hashString("quux.2da", hashAlgo), hashAlgo),
+		          static_cast<const char *>(0)) << "At algo " << algo;
+	}
+
+	EXPECT_EQ(dict.find(Common::hashString("foo.txt", Common::kHashDJB2), Common::kHashNone),
+	          static_cast<const char *>(0));
+}
+
+GTEST_TEST(NameDictionary, addAfterFind) {
+	Archives::NameDictionary dict;
+
+	dict.add("foo.txt");
+	EXPECT_EQ(dict.find(Common::hashString("bar.gda", Common::kHashFNV64), Common::kHashFNV64),
+	          static_cast<const char *>(0));
+
+	dict.add("bar.gda");
+
+	const char *name = dict.find(Common::hashString("bar.gda", Common::kHashFNV64), Common::kHashFNV64);
+	ASSERT_NE(name, static_cast<const char *>(0));
+	EXPECT_STREQ(name, "bar.gda");
+}
+
+GTEST_TEST(NameDictionary, findLowercase) {
+	Archives::NameDictionary dict;
+
+	dict.add("Data/Bar.gda");
+
+	const char *name = dict.find(Common::hashString("data/bar.gda", Common::kHashFNV64), Common::kHashFNV64);
+	ASSERT_NE(name, static_cast<const char *>(0));
+	EXPECT_STREQ(name, "Data/Bar.gda");
+}
+
+GTEST_TEST(NameDictionary, load) {
+	Common::MemoryReadStream stream(reinterpret_cast<const byte *>(kNames), std::strlen(kNames));
+
+	Archives::NameDictionary dict;
+	dict.load(stream);
+
+	EXPECT_EQ(dict.size(), 3);
+
+	const char *name1 = dict.find(Common::hashString("foo.txt", Common::kHashDJB2), Common::kHashDJB2);
+	ASSERT_NE(name1, static_cast<const char *>(0));
+	EXPECT_STREQ(name1, "foo.txt");
+
+	const char *name2 = dict.find(Common::hashString("data/bar.gda", Common::kHashDJB2), Common::kHashDJB2);
+	ASSERT_NE(name2, static_cast<const char *>(0));
+	EXPECT_STREQ(name2, "Data/Bar.gda");
+
+	const char *name3 = dict.find(Common::hashString("quux.2da", Common::kHashDJB2), Common::kHashDJB2);
+	ASSERT_NE(name3, static_cast<const char *>(0));
+	EXPECT_STREQ(name3, "quux.2da");
+
+	EXPECT_EQ(dict.find(Common::hashString("# a comment", Common::kHashDJB2), Common::kHashDJB2),
+	          static_cast<const char *>(0));
+}
@@ -22,10 +22,14 @@
  *  Unit tests for our BIF file archive class.
  */
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/biffile.h"
 #include "src/aurora/keyfile.h"
@@ -161,6 +165,32 @@ GTEST_TEST(BIFFile10, getResource) {
 	delete file;
 }
 
+GTEST_TEST(BIFFile10, readResources) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kBIF10File);
+	const Aurora::BIFFile bif(stream);
+
+	const size_t size = strlen(kFileData);
+
+	std::vector<byte> data1(size), data2(size), data3(size);
+
+	Aurora::KEYDataFile::ResourceBufferList resources;
+	resources.push_back(Aurora::KEYDataFile::ResourceBuffer(0, data1.data()));
+	resources.push_back(Aurora::KEYDataFile::ResourceBuffer(1, data2.data()));
+	resources.push_back(Aurora::KEYDataFile::ResourceBuffer(0, data3.data()));
+
+	Common::ThreadPool pool(2);
+	bif.readResources(resources, pool);
+
+	EXPECT_FALSE(resources[0].error);
+	EXPECT_TRUE (resources[1].error);
+	EXPECT_FALSE(resources[2].error);
+
+	for (size_t i = 0; i < size; i++) {
+		EXPECT_EQ(data1[i], kFileData[i]) << "At index " << i;
+		EXPECT_EQ(data3[i], kFileData[i]) << "At index " << i;
+	}
+}
+
 GTEST_TEST(BIFFile10, mergeKEY) {
 	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kBIF10File);
 	Aurora::BIFFile bif(stream);
@@ -168,6 +198,8 @@ GTEST_TEST(BIFFile10, mergeKEY) {
 	Common::MemoryReadStream keyStream(kKEYFile);
 	Aurora::KEYFile key(keyStream);
 
+	EXPECT_EQ(bif.findResource("ozymandias", Aurora::kFileTypeTXT), 0xFFFFFFFF);
+
 	bif.mergeKEY(key, 0);
 
 	EXPECT_EQ(bif.findResource("ozymandias", Aurora::kFileTypeTXT), 0);
@@ -183,6 +215,61 @@ GTEST_TEST(BIFFile10, mergeKEY) {
 	EXPECT_EQ(resource.index, 0);
 }
 
+GTEST_TEST(BIFFile10, writeIndex) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kBIF10File);
+	Aurora::BIFFile bif(stream);
+
+	Common::MemoryReadStream keyStream(kKEYFile);
+	Aurora::KEYFile key(keyStream);
+
+	bif.mergeKEY(key, 0);
+
+	Common::MemoryWriteStreamDynamic index(true);
+	bif.writeIndex(index);
+
+	Common::MemoryReadStream indexStream(index.getData(), index.size());
+	const Aurora::BIFFile indexBIFFile(new Common::MemoryReadStream(kBIF10File), indexStream);
+
+	EXPECT_EQ(indexBIFFile.getInternalResourceCount(), 1);
+	EXPECT_EQ(indexBIFFile.findResource("ozymandias", Aurora::kFileTypeTXT), 0);
+
+	const Aurora::BIFFile::ResourceList &resources = indexBIFFile.getResources();
+	ASSERT_EQ(resources.size(), 1);
+
+	const Aurora::BIFFile::Resource &resource = *resources.begin();
+
+	EXPECT_STREQ(resource.name.c_str(), "ozymandias");
+	EXPECT_EQ(resource.type, Aurora::kFileTypeTXT);
+	EXPECT_EQ(resource.index, 0);
+
+	EXPECT_EQ(indexBIFFile.getResourceSize(0), strlen(kFileData));
+
+	Common::SeekableReadStream *file = indexBIFFile.getResource(0);
+	ASSERT_NE(file, static_cast<Common::SeekableReadStream *>(0));
+
+	ASSERT_EQ(file->size(), strlen(kFileData));
+
+	for (size_t i = 0; i < strlen(kFileData); i++)
+		EXPECT_EQ(file->readByte(), kFileData[i]) << "At index " << i;
+
+	delete file;
+}
+
+GTEST_TEST(BIFFile10, readIndexBroken) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kBIF10File);
+	Aurora::BIFFile bif(stream);
+
+	Common::MemoryWriteStreamDynamic index(true);
+	bif.writeIndex(index);
+
+	// Claim far more internal resources than the index has room for
+	std::vector<byte> brokenIndex(index.getData(), index.getData() + index.size());
+	brokenIndex[8] = brokenIndex[9] = brokenIndex[10] = brokenIndex[11] = 0xFF;
+
+	Common::MemoryReadStream indexStream(brokenIndex.data(), brokenIndex.size());
+	EXPECT_THROW(Aurora::BIFFile(new Common::MemoryReadStream(kBIF10File), indexStream), Common::Exception);
+}
+
 // --- BIF V1.1 ---
 
 // Percy Bysshe Shelley's "Ozymandias", within a BIF V1.1 file
@@ -294,6 +381,8 @@ GTEST_TEST(BIFFile11, mergeKEY) {
 	Common::MemoryReadStream keyStream(kKEYFile);
 	Aurora::KEYFile key(keyStream);
 
+	EXPECT_EQ(bif.findResource("ozymandias", Aurora::kFileTypeTXT), 0xFFFFFFFF);
+
 	bif.mergeKEY(key, 0);
 
 	EXPECT_EQ(bif.findResource("ozymandias", Aurora::kFileTypeTXT), 0);
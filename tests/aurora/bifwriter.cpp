@@ -482,3 +482,36 @@ GTEST_TEST(BIFWriter, writeMultipleFiles) {
 
 	delete dataStream;
 }
+
+GTEST_TEST(BIFWriter, writeDuplicateFiles) {
+	const size_t kLogoDataSize = ARRAYSIZE(kLogoData);
+	const size_t kTextLength = strlen(kFileData) + 1;
+
+	Common::MemoryReadStream textStream(kFileData, true);
+	Common::MemoryReadStream imageStream(kLogoData);
+	Common::MemoryWriteStreamDynamic writeStream(false);
+	Aurora::BIFWriter bif(3, writeStream, true);
+
+	bif.add(textStream, Aurora::kFileTypeTXT);
+	bif.add(imageStream, Aurora::kFileTypeBMP);
+	bif.add(textStream, Aurora::kFileTypeTXT);
+
+	EXPECT_EQ(bif.size(), 20 + (3 * 16) + kTextLength + kLogoDataSize);
+	EXPECT_EQ(bif.getBytesSaved(), kTextLength);
+
+	Common::MemoryReadStream *bifStream = new Common::MemoryReadStream(writeStream.getData(), writeStream.size(), true);
+	const Aurora::BIFFile bifFile(bifStream);
+
+	EXPECT_EQ(bifFile.getInternalResourceCount(), 3);
+	EXPECT_EQ(bifFile.getResourceSize(0), kTextLength);
+	EXPECT_EQ(bifFile.getResourceSize(1), kLogoDataSize);
+	EXPECT_EQ(bifFile.getResourceSize(2), kTextLength);
+
+	for (uint32_t i = 0; i < 3; i += 2) {
+		std::unique_ptr<Common::SeekableReadStream> dataStream(bifFile.getResource(i));
+		std::unique_ptr<char[]> txt = std::make_unique<char[]>(dataStream->size());
+		dataStream->read(txt.get(), dataStream->size());
+
+		EXPECT_STREQ(txt.get(), kFileData);
+	}
+}
@@ -26,6 +26,8 @@
 
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/bzffile.h"
 #include "src/aurora/keyfile.h"
@@ -147,6 +149,32 @@ GTEST_TEST(BZFFile, getResource) {
 	delete file;
 }
 
+GTEST_TEST(BZFFile, readResources) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kBZFFile);
+	const Aurora::BZFFile bzf(stream);
+
+	const size_t size = strlen(kFileData);
+
+	std::vector<byte> data1(size), data2(size), data3(size);
+
+	Aurora::KEYDataFile::ResourceBufferList resources;
+	resources.push_back(Aurora::KEYDataFile::ResourceBuffer(0, data1.data()));
+	resources.push_back(Aurora::KEYDataFile::ResourceBuffer(1, data2.data()));
+	resources.push_back(Aurora::KEYDataFile::ResourceBuffer(0, data3.data()));
+
+	Common::ThreadPool pool(2);
+	bzf.readResources(resources, pool);
+
+	EXPECT_FALSE(resources[0].error);
+	EXPECT_TRUE (resources[1].error);
+	EXPECT_FALSE(resources[2].error);
+
+	for (size_t i = 0; i < size; i++) {
+		EXPECT_EQ(data1[i], kFileData[i]) << "At index " << i;
+		EXPECT_EQ(data3[i], kFileData[i]) << "At index " << i;
+	}
+}
+
 GTEST_TEST(BZFFile, mergeKEY) {
 	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kBZFFile);
 	Aurora::BZFFile bzf(stream);
@@ -168,3 +196,43 @@ GTEST_TEST(BZFFile, mergeKEY) {
 	EXPECT_EQ(resource.hash, 0);
 	EXPECT_EQ(resource.index, 0);
 }
+
+GTEST_TEST(BZFFile, writeIndex) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kBZFFile);
+	Aurora::BZFFile bzf(stream);
+
+	Common::MemoryReadStream keyStream(kKEYFile);
+	Aurora::KEYFile key(keyStream);
+
+	bzf.mergeKEY(key, 0);
+
+	Common::MemoryWriteStreamDynamic index(true);
+	bzf.writeIndex(index);
+
+	Common::MemoryReadStream indexStream(index.getData(), index.size());
+	const Aurora::BZFFile indexBZFFile(new Common::MemoryReadStream(kBZFFile), indexStream);
+
+	EXPECT_EQ(indexBZFFile.getInternalResourceCount(), 1);
+	EXPECT_EQ(indexBZFFile.findResource("ozymandias", Aurora::kFileTypeTXT), 0);
+
+	const Aurora::BZFFile::ResourceList &resources = indexBZFFile.getResources();
+	ASSERT_EQ(resources.size(), 1);
+
+	const Aurora::BZFFile::Resource &resource = *resources.begin();
+
+	EXPECT_STREQ(resource.name.c_str(), "ozymandias");
+	EXPECT_EQ(resource.type, Aurora::kFileTypeTXT);
+	EXPECT_EQ(resource.index, 0);
+
+	EXPECT_EQ(indexBZFFile.getResourceSize(0), strlen(kFileData));
+
+	Common::SeekableReadStream *file = indexBZFFile.getResource(0);
+	ASSERT_NE(file, static_cast<Common::SeekableReadStream *>(0));
+
+	ASSERT_EQ(file->size(), strlen(kFileData));
+
+	for (size_t i = 0; i < strlen(kFileData); i++)
+		EXPECT_EQ(file->readByte(), kFileData[i]) << "At index " << i;
+
+	delete file;
+}
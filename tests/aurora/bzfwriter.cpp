@@ -23,8 +23,14 @@
  * Unit tests for our BZF file writer
  */
 
+#include <cstring>
+
+#include <vector>
+#include <memory>
+
 #include "gtest/gtest.h"
 
+#include "src/common/error.h"
 #include "src/common/memreadstream.h"
 #include "src/common/memwritestream.h"
 
@@ -482,3 +488,55 @@ GTEST_TEST(BZFWriter, writeMultipleFiles) {
 
 	delete dataStream;
 }
+
+GTEST_TEST(BZFWriter, writeDuplicateFiles) {
+	const size_t kLogoDataSize = ARRAYSIZE(kLogoData);
+
+	Common::MemoryReadStream textStream(kFileData, true);
+	Common::MemoryReadStream imageStream(kLogoData);
+	Common::MemoryWriteStreamDynamic writeStream(true);
+
+	// BZF files can't share data, so the duplicate text has to be written again
+	Aurora::BZFWriter bzf(3, writeStream);
+
+	bzf.add(textStream, Aurora::kFileTypeTXT);
+	bzf.add(imageStream, Aurora::kFileTypeBMP);
+	bzf.add(textStream, Aurora::kFileTypeTXT);
+
+	EXPECT_EQ(bzf.getBytesSaved(), 0);
+
+	const Aurora::BZFFile bzfFile(new Common::MemoryReadStream(writeStream.getData(), writeStream.size()));
+	ASSERT_EQ(bzfFile.getInternalResourceCount(), 3);
+
+	for (uint32_t i = 0; i < 3; i += 2) {
+		std::unique_ptr<Common::SeekableReadStream> dataStream(bzfFile.getResource(i));
+		ASSERT_EQ(dataStream->size(), strlen(kFileData) + 1);
+
+		std::unique_ptr<char[]> txt = std::make_unique<char[]>(dataStream->size());
+		dataStream->read(txt.get(), dataStream->size());
+
+		EXPECT_STREQ(txt.get(), kFileData) << "At resource " << i;
+	}
+
+	std::unique_ptr<Common::SeekableReadStream> dataStream(bzfFile.getResource(1));
+	ASSERT_EQ(dataStream->size(), kLogoDataSize);
+
+	for (size_t i = 0; i < kLogoDataSize; i++)
+		EXPECT_EQ(dataStream->readByte(), kLogoData[i]) << "At index " << i;
+}
+
+GTEST_TEST(BZFWriter, readDescendingOffsets) {
+	Common::MemoryReadStream textStream(kFileData, true);
+	Common::MemoryWriteStreamDynamic writeStream(true);
+
+	Aurora::BZFWriter bzf(2, writeStream);
+
+	bzf.add(textStream, Aurora::kFileTypeTXT);
+	bzf.add(textStream, Aurora::kFileTypeTXT);
+
+	// Point the second resource back at the first one's data
+	std::vector<byte> data(writeStream.getData(), writeStream.getData() + writeStream.size());
+	std::memcpy(&data[20 + 16 + 4], &data[20 + 4], 4);
+
+	EXPECT_THROW(Aurora::BZFFile(new Common::MemoryReadStream(data.data(), data.size())), Common::Exception);
+}
@@ -22,6 +22,8 @@
  *  Unit tests for our ERF file archive class.
  */
 
+#include <memory>
+
 #include "gtest/gtest.h"
 
 #include "src/common/error.h"
@@ -1209,6 +1211,20 @@ GTEST_TEST(ERFFile22DeflateHeader, getResource) {
 	delete file;
 }
 
+GTEST_TEST(ERFFile22DeflateHeader, getResourceStream) {
+	const Aurora::ERFFile erf(new Common::MemoryReadStream(kERFFile22DH));
+
+	std::unique_ptr<Common::ReadStream> file(erf.getResourceStream(0));
+	ASSERT_TRUE(file);
+
+	for (size_t i = 0; i < strlen(kFileData); i++)
+		EXPECT_EQ(file->readByte(), kFileData[i]) << "At index " << i;
+
+	byte data;
+	EXPECT_EQ(file->read(&data, 1), 0);
+	EXPECT_TRUE(file->eos());
+}
+
 // --- ERF V2.2 (DEFLATE, raw) ---
 
 // Percy Bysshe Shelley's "Ozymandias", within an ERF V2.2 (DEFLATE, raw) file
@@ -1343,6 +1359,20 @@ GTEST_TEST(ERFFile22DeflateRaw, getResource) {
 	delete file;
 }
 
+GTEST_TEST(ERFFile22DeflateRaw, getResourceStream) {
+	const Aurora::ERFFile erf(new Common::MemoryReadStream(kERFFile22DR));
+
+	std::unique_ptr<Common::ReadStream> file(erf.getResourceStream(0));
+	ASSERT_TRUE(file);
+
+	for (size_t i = 0; i < strlen(kFileData); i++)
+		EXPECT_EQ(file->readByte(), kFileData[i]) << "At index " << i;
+
+	byte data;
+	EXPECT_EQ(file->read(&data, 1), 0);
+	EXPECT_TRUE(file->eos());
+}
+
 // --- ERF V2.2 (Blowfish) ---
 
 // Percy Bysshe Shelley's "Ozymandias", within an ERF V2.2 (Blowfish) file
@@ -1649,6 +1679,21 @@ GTEST_TEST(ERFFile22BlowfishDeflateRaw, getResource) {
 	delete file;
 }
 
+GTEST_TEST(ERFFile22BlowfishDeflateRaw, getResourceStream) {
+	PasswordStore password(kERF22BDRPassword);
+	const Aurora::ERFFile erf(new Common::MemoryReadStream(kERFFile22BDR), password);
+
+	std::unique_ptr<Common::ReadStream> file(erf.getResourceStream(0));
+	ASSERT_TRUE(file);
+
+	for (size_t i = 0; i < strlen(kFileData); i++)
+		EXPECT_EQ(file->readByte(), kFileData[i]) << "At index " << i;
+
+	byte data;
+	EXPECT_EQ(file->read(&data, 1), 0);
+	EXPECT_TRUE(file->eos());
+}
+
 // --- ERF V3.0 (plain) ---
 
 // Percy Bysshe Shelley's "Ozymandias", within an ERF V3.0 (plain) file
@@ -0,0 +1,184 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for updating ERF archives in place.
+ */
+
+#include <memory>
+
+#include <boost/filesystem.hpp>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/strutil.h"
+#include "src/common/platform.h"
+#include "src/common/readfile.h"
+#include "src/common/writefile.h"
+#include "src/common/memreadstream.h"
+#include "src/common/filepath.h"
+
+#include "src/aurora/erfwriter.h"
+#include "src/aurora/erfupdater.h"
+#include "src/aurora/erffile.h"
+
+static boost::filesystem::path kFilePath;
+
+class ERFUpdater : public ::testing::Test {
+protected:
+	static void SetUpTestCase() {
+		Common::Platform::init();
+
+		boost::filesystem::path tmpPath    = boost::filesystem::temp_directory_path();
+		boost::filesystem::path uniquePath = boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+		kFilePath = tmpPath / uniquePath;
+	}
+
+	static void TearDownTestCase() {
+		if (!kFilePath.empty())
+			boost::filesystem::remove(kFilePath);
+	}
+};
+
+/** The contents of a test file: its name, repeated count times. */
+static Common::UString createData(const Common::UString &name, size_t count) {
+	Common::UString data;
+	for (size_t i = 0; i < count; i++)
+		data += name + "\n";
+
+	return data;
+}
+
+static void createERF(Aurora::ERFWriter::Version version, Aurora::ERFWriter::Compression compression) {
+	Common::WriteFile file(kFilePath.generic_string());
+
+	Aurora::ERFWriter erf(MKTAG('E', 'R', 'F', ' '), 4, file, version, compression);
+
+	for (size_t i = 0; i < 4; i++) {
+		const Common::UString name = Common::composeString(i);
+		const Common::UString data = createData(name, 50);
+
+		Common::MemoryReadStream stream(reinterpret_cast<const byte *>(data.c_str()), data.size());
+		erf.add(name, Aurora::kFileTypeTXT, stream);
+	}
+}
+
+static void expectFile(const Aurora::ERFFile &erf, const Common::UString &name, size_t count) {
+	const uint32_t index = erf.findResource(name, Aurora::kFileTypeTXT);
+	ASSERT_NE(index, 0xFFFFFFFF) << name.c_str();
+
+	const Common::UString data = createData(name, count);
+
+	std::unique_ptr<Common::SeekableReadStream> stream(erf.getResource(index));
+	ASSERT_EQ(stream->size(), data.size()) << name.c_str();
+
+	for (size_t i = 0; i < data.size(); i++)
+		ASSERT_EQ(stream->readByte(), static_cast<byte>(data.c_str()[i])) << name.c_str() << ", at index " << i;
+}
+
+static void expectFiles(const Common::UString &version) {
+	const Aurora::ERFFile erf(new Common::ReadFile(kFilePath.generic_string()));
+
+	EXPECT_EQ(erf.getResources().size(), 5) << version.c_str();
+
+	expectFile(erf, "0", 50);
+	expectFile(erf, "1", 10);
+	expectFile(erf, "3", 50);
+	expectFile(erf, "4", 200);
+	expectFile(erf, "5", 1);
+
+	EXPECT_EQ(erf.findResource("2", Aurora::kFileTypeTXT), 0xFFFFFFFF) << version.c_str();
+}
+
+GTEST_TEST_F(ERFUpdater, updateAndCompact) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	static const Aurora::ERFWriter::Version kVersions[] = {
+		Aurora::ERFWriter::kERFVersion10,
+		Aurora::ERFWriter::kERFVersion20,
+		Aurora::ERFWriter::kERFVersion22,
+		Aurora::ERFWriter::kERFVersion22,
+		Aurora::ERFWriter::kERFVersion22
+	};
+
+	static const Aurora::ERFWriter::Compression kCompressions[] = {
+		Aurora::ERFWriter::kCompressionNone,
+		Aurora::ERFWriter::kCompressionNone,
+		Aurora::ERFWriter::kCompressionNone,
+		Aurora::ERFWriter::kCompressionBiowareZlib,
+		Aurora::ERFWriter::kCompressionHeaderlessZlib
+	};
+
+	for (size_t v = 0; v < ARRAYSIZE(kVersions); v++) {
+		const Common::UString version = Common::composeString(v);
+
+		createERF(kVersions[v], kCompressions[v]);
+
+		{
+			Aurora::ERFUpdater updater(kFilePath.generic_string());
+			EXPECT_EQ(updater.getUnusedSize(), 0) << version.c_str();
+
+			// Replace one file, remove one and add two, so that the tables grow
+			const Common::UString data1 = createData("1", 10);
+			const Common::UString data4 = createData("4", 200);
+			const Common::UString data5 = createData("5", 1);
+
+			Common::MemoryReadStream stream1(reinterpret_cast<const byte *>(data1.c_str()), data1.size());
+			Common::MemoryReadStream stream4(reinterpret_cast<const byte *>(data4.c_str()), data4.size());
+			Common::MemoryReadStream stream5(reinterpret_cast<const byte *>(data5.c_str()), data5.size());
+
+			updater.add("1", Aurora::kFileTypeTXT, stream1);
+			updater.add("4", Aurora::kFileTypeTXT, stream4);
+			updater.add("5", Aurora::kFileTypeTXT, stream5);
+
+			EXPECT_TRUE(updater.remove("2", Aurora::kFileTypeTXT)) << version.c_str();
+			EXPECT_FALSE(updater.remove("2", Aurora::kFileTypeTXT)) << version.c_str();
+
+			updater.flush();
+
+			EXPECT_EQ(updater.getFileCount(), 5) << version.c_str();
+			/* The compressed files are so small that the grown V2.2 resource
+			 * table covers all the old data, leaving no unused space. */
+			if (kCompressions[v] == Aurora::ERFWriter::kCompressionNone) {
+				EXPECT_GT(updater.getUnusedSize(), 0) << version.c_str();
+			}
+		}
+
+		expectFiles(version);
+
+		const size_t updatedSize = Common::FilePath::getFileSize(kFilePath.generic_string());
+
+		size_t unusedSize = 0;
+		{
+			Aurora::ERFUpdater updater(kFilePath.generic_string());
+
+			unusedSize = updater.getUnusedSize();
+			updater.compact();
+
+			EXPECT_EQ(updater.getUnusedSize(), 0) << version.c_str();
+		}
+
+		expectFiles(version);
+
+		EXPECT_EQ(Common::FilePath::getFileSize(kFilePath.generic_string()), updatedSize - unusedSize) << version.c_str();
+	}
+}
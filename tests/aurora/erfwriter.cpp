@@ -22,8 +22,14 @@
  *  Unit tests for our ERF file archive writer class.
  */
 
+#include <cstring>
+#include <memory>
+
 #include "gtest/gtest.h"
 
+#include "src/common/util.h"
+#include "src/common/strutil.h"
+#include "src/common/memreadstream.h"
 #include "src/common/memwritestream.h"
 
 #include "src/aurora/erfwriter.h"
@@ -539,6 +545,43 @@ GTEST_TEST(ERFWriter, WriteMultipleFiles) {
 	delete readStream3;
 }
 
+GTEST_TEST(ERFWriter, WriteDuplicateFiles) {
+	Common::MemoryReadStream dataStream1(kFileData, true);
+	const size_t kFileDataSize = dataStream1.size();
+
+	const size_t kLogoDataSize = sizeof(kLogoData);
+	Common::MemoryReadStream dataStream2(kLogoData, kLogoDataSize);
+
+	Common::MemoryWriteStreamDynamic writeStream;
+	Aurora::ERFWriter erfWriter(MKTAG('E', 'R', 'F', ' '), 3, writeStream, Aurora::ERFWriter::kERFVersion10,
+	                            Aurora::ERFWriter::kCompressionNone, Aurora::LocString(), 1, 0, true);
+	erfWriter.add("ozymandias_1", Aurora::kFileTypeTXT, dataStream1);
+	erfWriter.add("logo", Aurora::kFileTypeBMP, dataStream2);
+	dataStream1.seek(0);
+	erfWriter.add("ozymandias_2", Aurora::kFileTypeTXT, dataStream1);
+
+	EXPECT_EQ(erfWriter.getBytesSaved(), kFileDataSize);
+	EXPECT_EQ(writeStream.size(), 160 + 3 * (24 + 8) + kFileDataSize + kLogoDataSize);
+
+	const Aurora::ERFFile erf(new Common::MemoryReadStream(writeStream.getData(), writeStream.size(), true));
+
+	EXPECT_EQ(erf.getResources().size(), 3);
+
+	const uint32_t indices[] = {
+		erf.findResource("ozymandias_1", Aurora::kFileTypeTXT),
+		erf.findResource("ozymandias_2", Aurora::kFileTypeTXT)
+	};
+
+	for (size_t i = 0; i < ARRAYSIZE(indices); i++) {
+		std::unique_ptr<Common::SeekableReadStream> readStream(erf.getResource(indices[i]));
+		ASSERT_EQ(readStream->size(), kFileDataSize);
+
+		for (size_t j = 0; j < kFileDataSize; ++j) {
+			EXPECT_EQ(readStream->readByte(), static_cast<byte>(kFileData[j]));
+		}
+	}
+}
+
 GTEST_TEST(ERFWriter, WriteEmptyV20) {
 	Common::MemoryWriteStreamDynamic writeStream;
 	Aurora::ERFWriter erfWriter(MKTAG('E', 'R', 'F', ' '), 0, writeStream, Aurora::ERFWriter::kERFVersion20);
@@ -904,3 +947,118 @@ GTEST_TEST(ERFWriter, WriteMultipleFilesV22HeaderlessZlib) {
 	delete readStream2;
 	delete readStream3;
 }
+
+static void writeMultipleFilesV22(Common::MemoryWriteStreamDynamic &writeStream, Aurora::ERFWriter::Compression compression,
+                                  size_t threadCount, size_t windowSize, bool deduplicate = false) {
+
+	Common::MemoryReadStream dataStream1(kFileData, true);
+	Common::MemoryReadStream dataStream2(kLogoData, sizeof(kLogoData));
+
+	Aurora::ERFWriter erfWriter(MKTAG('E', 'R', 'F', ' '), 6, writeStream, Aurora::ERFWriter::kERFVersion22, compression,
+	                            Aurora::LocString(), threadCount, windowSize, deduplicate);
+
+	for (size_t i = 0; i < 3; i++) {
+		dataStream1.seek(0);
+		dataStream2.seek(0);
+
+		erfWriter.add(Common::composeString(i), Aurora::kFileTypeTXT, dataStream1);
+		erfWriter.add(Common::composeString(i), Aurora::kFileTypeBMP, dataStream2);
+	}
+
+	erfWriter.flush();
+}
+
+GTEST_TEST(ERFWriter, WriteMultipleFilesV22Parallel) {
+	static const Aurora::ERFWriter::Compression kCompressions[] = {
+		Aurora::ERFWriter::kCompressionNone,
+		Aurora::ERFWriter::kCompressionBiowareZlib,
+		Aurora::ERFWriter::kCompressionHeaderlessZlib
+	};
+
+	for (size_t c = 0; c < ARRAYSIZE(kCompressions); c++) {
+		Common::MemoryWriteStreamDynamic serialStream(true);
+		writeMultipleFilesV22(serialStream, kCompressions[c], 1, 0);
+
+		for (size_t windowSize = 0; windowSize < 3; windowSize++) {
+			Common::MemoryWriteStreamDynamic parallelStream(true);
+			writeMultipleFilesV22(parallelStream, kCompressions[c], 3, windowSize);
+
+			ASSERT_EQ(parallelStream.size(), serialStream.size()) << "Compression " << c << ", window " << windowSize;
+			EXPECT_EQ(std::memcmp(parallelStream.getData(), serialStream.getData(), serialStream.size()), 0)
+				<< "Compression " << c << ", window " << windowSize;
+		}
+
+		const Aurora::ERFFile erf(new Common::MemoryReadStream(serialStream.getData(), serialStream.size()));
+		ASSERT_EQ(erf.getResources().size(), 6);
+
+		std::unique_ptr<Common::SeekableReadStream> readStream(erf.getResource(erf.findResource("2", Aurora::kFileTypeBMP)));
+		ASSERT_EQ(readStream->size(), sizeof(kLogoData));
+
+		for (size_t i = 0; i < sizeof(kLogoData); i++)
+			EXPECT_EQ(readStream->readByte(), kLogoData[i]) << "At index " << i;
+	}
+}
+
+GTEST_TEST(ERFWriter, WriteDuplicateFilesV22Parallel) {
+	static const Aurora::ERFWriter::Compression kCompressions[] = {
+		Aurora::ERFWriter::kCompressionNone,
+		Aurora::ERFWriter::kCompressionBiowareZlib,
+		Aurora::ERFWriter::kCompressionHeaderlessZlib
+	};
+
+	for (size_t c = 0; c < ARRAYSIZE(kCompressions); c++) {
+		Common::MemoryWriteStreamDynamic fullStream(true);
+		writeMultipleFilesV22(fullStream, kCompressions[c], 1, 0);
+
+		Common::MemoryWriteStreamDynamic serialStream(true);
+		writeMultipleFilesV22(serialStream, kCompressions[c], 1, 0, true);
+
+		EXPECT_LT(serialStream.size(), fullStream.size()) << "Compression " << c;
+
+		for (size_t windowSize = 0; windowSize < 3; windowSize++) {
+			Common::MemoryWriteStreamDynamic parallelStream(true);
+			writeMultipleFilesV22(parallelStream, kCompressions[c], 3, windowSize, true);
+
+			ASSERT_EQ(parallelStream.size(), serialStream.size()) << "Compression " << c << ", window " << windowSize;
+			EXPECT_EQ(std::memcmp(parallelStream.getData(), serialStream.getData(), serialStream.size()), 0)
+				<< "Compression " << c << ", window " << windowSize;
+		}
+
+		const Aurora::ERFFile erf(new Common::MemoryReadStream(serialStream.getData(), serialStream.size()));
+		ASSERT_EQ(erf.getResources().size(), 6);
+
+		for (size_t i = 0; i < 3; i++) {
+			std::unique_ptr<Common::SeekableReadStream> readStream(erf.getResource(erf.findResource(Common::composeString(i), Aurora::kFileTypeBMP)));
+			ASSERT_EQ(readStream->size(), sizeof(kLogoData));
+
+			for (size_t j = 0; j < sizeof(kLogoData); j++)
+				EXPECT_EQ(readStream->readByte(), kLogoData[j]) << "At index " << j;
+		}
+	}
+}
+
+GTEST_TEST(ERFWriter, WriteIncompressibleFileV22) {
+	// Pseudo-random data, which zlib can't compress. This needs several output buffers
+	std::unique_ptr<byte[]> data = std::make_unique<byte[]>(65536);
+
+	uint32_t seed = 0x12345678;
+	for (size_t i = 0; i < 65536; i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = seed >> 24;
+	}
+
+	Common::MemoryReadStream dataStream(data.get(), 65536);
+
+	Common::MemoryWriteStreamDynamic writeStream(true);
+	Aurora::ERFWriter erfWriter(MKTAG('E', 'R', 'F', ' '), 1, writeStream, Aurora::ERFWriter::kERFVersion22,
+	                            Aurora::ERFWriter::kCompressionHeaderlessZlib);
+	erfWriter.add("random", Aurora::kFileTypeBIN, dataStream);
+
+	const Aurora::ERFFile erf(new Common::MemoryReadStream(writeStream.getData(), writeStream.size()));
+
+	std::unique_ptr<Common::SeekableReadStream> readStream(erf.getResource(0));
+	ASSERT_EQ(readStream->size(), 65536);
+
+	for (size_t i = 0; i < 65536; i++)
+		ASSERT_EQ(readStream->readByte(), data[i]) << "At index " << i;
+}
@@ -196,6 +196,49 @@ GTEST_TEST(GFF3Struct, getUint) {
 	EXPECT_THROW(strct.getUint("FieldLocString"), Common::Exception);
 }
 
+GTEST_TEST(GFF3File, getLabelID) {
+	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3SingleStruct));
+
+	for (size_t i = 0; i < ARRAYSIZE(kFieldNamesSingle); i++) {
+		const uint32_t id = gff3.getLabelID(kFieldNamesSingle[i]);
+		ASSERT_NE(id, Aurora::GFF3File::kLabelIDNone) << "At index " << i;
+
+		EXPECT_STREQ(gff3.getLabel(id).c_str(), kFieldNamesSingle[i]) << "At index " << i;
+	}
+
+	EXPECT_EQ(gff3.getLabelID("Nope"), Aurora::GFF3File::kLabelIDNone);
+
+	EXPECT_THROW(gff3.getLabel(ARRAYSIZE(kFieldNamesSingle)), Common::Exception);
+}
+
+GTEST_TEST(GFF3Struct, getFieldLabels) {
+	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3SingleStruct));
+	const Aurora::GFF3Struct &strct = gff3.getTopLevel();
+
+	const std::vector<uint32_t> labels = strct.getFieldLabels();
+	ASSERT_EQ(labels.size(), ARRAYSIZE(kFieldNamesSingle));
+
+	for (size_t i = 0; i < ARRAYSIZE(kFieldNamesSingle); i++)
+		EXPECT_STREQ(gff3.getLabel(labels[i]).c_str(), kFieldNamesSingle[i]) << "At index " << i;
+}
+
+GTEST_TEST(GFF3Struct, getUintByLabelID) {
+	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3SingleStruct));
+	const Aurora::GFF3Struct &strct = gff3.getTopLevel();
+
+	EXPECT_EQ(strct.getUint(gff3.getLabelID("FieldByte"  )), 23);
+	EXPECT_EQ(strct.getUint(gff3.getLabelID("FieldUint64")), 42);
+	EXPECT_EQ(strct.getSint(gff3.getLabelID("FieldSint32")), -25);
+
+	EXPECT_STREQ(strct.getString(gff3.getLabelID("FieldExoString")).c_str(), "Foobar");
+
+	EXPECT_TRUE(strct.hasField(gff3.getLabelID("FieldVector")));
+	EXPECT_EQ(strct.getFieldType(gff3.getLabelID("FieldVector")), Aurora::GFF3Struct::kFieldTypeVector);
+
+	EXPECT_FALSE(strct.hasField(Aurora::GFF3File::kLabelIDNone));
+	EXPECT_EQ(strct.getUint(Aurora::GFF3File::kLabelIDNone, 99), 99);
+}
+
 GTEST_TEST(GFF3Struct, getSint) {
 	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3SingleStruct));
 	const Aurora::GFF3Struct &strct = gff3.getTopLevel();
@@ -420,6 +463,26 @@ GTEST_TEST(GFF3Struct, getData) {
 	EXPECT_THROW(strct.getData("FieldUint16"), Common::Exception);
 }
 
+GTEST_TEST(GFF3File, sectionOutsideStream) {
+	std::vector<byte> data(kGFF3SingleStruct, kGFF3SingleStruct + sizeof(kGFF3SingleStruct));
+
+	// Field count, making the field section reach past the end of the file
+	WRITE_LE_UINT32(&data[20], 0x01000000);
+
+	EXPECT_THROW(Aurora::GFF3File gff3(new Common::MemoryReadStream(data.data(), data.size())),
+	             Common::Exception);
+}
+
+GTEST_TEST(GFF3File, labelOutOfRange) {
+	std::vector<byte> data(kGFF3SingleStruct, kGFF3SingleStruct + sizeof(kGFF3SingleStruct));
+
+	// Label index of the first field, one past the 17 labels
+	WRITE_LE_UINT32(&data[0x48], 17);
+
+	EXPECT_THROW(Aurora::GFF3File gff3(new Common::MemoryReadStream(data.data(), data.size())),
+	             Common::Exception);
+}
+
 // --- GFF3, NWN premium ---
 
 GTEST_TEST(GFF3File, premiumNWN) {
@@ -524,39 +587,39 @@ GTEST_TEST(GFF3Struct, getStruct) {
 
 // --- GFF3, lists ---
 
-GTEST_TEST(GFF3Struct, getList) {
-	static const byte kGFF3Lists[] = {
-		0x47,0x46,0x46,0x20,0x56,0x33,0x2E,0x32,0x38,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,
-		0xB0,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x58,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
-		0x78,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x01,0x00,0x00,0x20,0x00,0x00,0x00,
-		0x98,0x01,0x00,0x00,0x34,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x02,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
-		0x19,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
-		0x18,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
-		0x01,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-		0x1D,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,
-		0x0B,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
-		0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-		0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,
-		0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x21,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
-		0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,
-		0x01,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x23,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
-		0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x26,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
-		0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x46,0x69,0x65,0x6C,0x64,0x55,0x69,0x6E,
-		0x74,0x33,0x32,0x00,0x00,0x00,0x00,0x00,0x46,0x69,0x65,0x6C,0x64,0x4C,0x69,0x73,
-		0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-		0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
-		0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
-		0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
-		0x05,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
-		0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00
-	};
+static const byte kGFF3Lists[] = {
+	0x47,0x46,0x46,0x20,0x56,0x33,0x2E,0x32,0x38,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,
+	0xB0,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x58,0x01,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x78,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x01,0x00,0x00,0x20,0x00,0x00,0x00,
+	0x98,0x01,0x00,0x00,0x34,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+	0x19,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1A,0x00,0x00,0x00,
+	0x18,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x1B,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+	0x1D,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,
+	0x0B,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x0D,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x21,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,
+	0x01,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x23,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x26,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x00,
+	0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x46,0x69,0x65,0x6C,0x64,0x55,0x69,0x6E,
+	0x74,0x33,0x32,0x00,0x00,0x00,0x00,0x00,0x46,0x69,0x65,0x6C,0x64,0x4C,0x69,0x73,
+	0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+	0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x00,0x00,
+	0x05,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+	0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x09,0x00,0x00,0x00
+};
 
+GTEST_TEST(GFF3Struct, getList) {
 	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3Lists));
 	const Aurora::GFF3Struct &strct0 = gff3.getTopLevel();
 
@@ -636,6 +699,82 @@ GTEST_TEST(GFF3Struct, getList) {
 	EXPECT_EQ(strct9.getUint("FieldUint32"), 41);
 }
 
+GTEST_TEST(GFF3Struct, getListLazy) {
+	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3Lists), 0xFFFFFFFF, false, true);
+	const Aurora::GFF3Struct &strct0 = gff3.getTopLevel();
+
+	EXPECT_EQ(strct0.getID(), 23);
+	EXPECT_EQ(strct0.getUint("FieldUint32"), 32);
+
+	const Aurora::GFF3List &list0 = strct0.getList("FieldList");
+	ASSERT_EQ(list0.size(), 3);
+	ASSERT_NE(list0[1], static_cast<const Aurora::GFF3Struct *>(0));
+
+	const Aurora::GFF3List &list2 = list0[1]->getList("FieldList");
+	ASSERT_EQ(list2.size(), 2);
+	ASSERT_NE(list2[1], static_cast<const Aurora::GFF3Struct *>(0));
+
+	EXPECT_EQ(list2[1]->getID(), 30);
+	EXPECT_EQ(list2[1]->getUint("FieldUint32"), 39);
+
+	// Reaching the same list again returns the same structs
+	EXPECT_EQ(&strct0.getList("FieldList"), &list0);
+	EXPECT_EQ(&list0[1]->getList("FieldList"), &list2);
+}
+
+GTEST_TEST(GFF3Struct, prefetch) {
+	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3Lists), 0xFFFFFFFF, false, true);
+	const Aurora::GFF3Struct &strct0 = gff3.getTopLevel();
+
+	strct0.prefetch();
+
+	const Aurora::GFF3List &list0 = strct0.getList("FieldList");
+	ASSERT_EQ(list0.size(), 3);
+
+	for (size_t i = 0; i < list0.size(); i++) {
+		ASSERT_NE(list0[i], static_cast<const Aurora::GFF3Struct *>(0));
+		EXPECT_EQ(list0[i]->getID(), 24 + i);
+
+		const Aurora::GFF3List &list = list0[i]->getList("FieldList");
+		ASSERT_EQ(list.size(), 2);
+
+		for (size_t j = 0; j < list.size(); j++) {
+			ASSERT_NE(list[j], static_cast<const Aurora::GFF3Struct *>(0));
+			EXPECT_EQ(list[j]->getID(), 27 + i * 2 + j);
+			EXPECT_EQ(list[j]->getUint("FieldUint32"), 36 + i * 2 + j);
+		}
+	}
+}
+
+GTEST_TEST(GFF3Struct, prefetchBroken) {
+	std::vector<byte> data(kGFF3Lists, kGFF3Lists + sizeof(kGFF3Lists));
+
+	// Field index of struct 4, the first struct in the first nested list, past the 14 fields
+	WRITE_LE_UINT32(&data[0x38 + 4 * 12 + 4], 14);
+
+	// Loading eagerly finds the broken struct right away
+	EXPECT_THROW(Aurora::GFF3File gff3(new Common::MemoryReadStream(data.data(), data.size())),
+	             Common::Exception);
+
+	Aurora::GFF3File gff3(new Common::MemoryReadStream(data.data(), data.size()), 0xFFFFFFFF, false, true);
+
+	// Lazily, the broken struct isn't decoded before it's reached
+	const Aurora::GFF3Struct &strct0 = gff3.getTopLevel();
+
+	const Aurora::GFF3List &list0 = strct0.getList("FieldList");
+	ASSERT_EQ(list0.size(), 3);
+	ASSERT_NE(list0[0], static_cast<const Aurora::GFF3Struct *>(0));
+	EXPECT_EQ(list0[0]->getID(), 24);
+
+	// Prefetching decodes the whole branch, finding the broken struct
+	EXPECT_THROW(strct0.prefetch(), Common::Exception);
+	EXPECT_THROW(list0[0]->prefetch(), Common::Exception);
+
+	// The branches without the broken struct still prefetch fine
+	ASSERT_NE(list0[1], static_cast<const Aurora::GFF3Struct *>(0));
+	list0[1]->prefetch();
+}
+
 // --- GFF3, V3.3 ---
 
 GTEST_TEST(GFF3File, GFF3V33) {
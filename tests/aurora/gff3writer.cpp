@@ -27,6 +27,7 @@
 #include "gtest/gtest.h"
 
 #include "src/common/util.h"
+#include "src/common/strutil.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
 #include "src/common/memwritestream.h"
@@ -348,3 +349,64 @@ GTEST_TEST(GFF3Writer, WriteEquivalentValues) {
 
 	delete writeStream;
 }
+
+GTEST_TEST(GFF3Writer, WriteManyFields) {
+	/* Regression benchmark: one million fields, with many duplicate values and labels.
+	 * Finding duplicates used to take quadratic time, so writing this took ages. */
+
+	static const uint32_t kStructCount = 100000;
+
+	Aurora::GFF3Writer writer(MKTAG('G', 'F', 'F', ' '), MKTAG('V', '3', '.', '2'));
+	Aurora::GFF3WriterListPtr list = writer.getTopLevel()->addList("Entries");
+
+	for (uint32_t i = 0; i < kStructCount; i++) {
+		Aurora::GFF3WriterStructPtr strct = list->addStruct(i);
+
+		strct->addUint32("ID", i);
+		strct->addUint64("Unique", i);
+		strct->addExoString("Name", (Common::UString("Name") + Common::composeString(i % 1000)));
+		strct->addResRef("ResRef", (Common::UString("res") + Common::composeString(i % 100)));
+		strct->addDouble("Double", (i % 10) * 0.5);
+		strct->addVector("Vector", i % 50, 0.0f, 0.0f);
+		strct->addSint32("Sint32", -static_cast<int32_t>(i));
+		strct->addFloat("Float", i * 0.25f);
+		strct->addByte("Byte", i % 256);
+		strct->addSint16("Sint16", i % 1000);
+	}
+
+	// Every individual value is only written once into the field data
+	uint32_t fieldDataSize = kStructCount * 8 + 10 * 8 + 50 * 12;
+	for (uint32_t i = 0; i < 1000; i++)
+		fieldDataSize += 4 + (Common::UString("Name") + Common::composeString(i)).size();
+	for (uint32_t i = 0; i < 100; i++)
+		fieldDataSize += 1 + (Common::UString("res") + Common::composeString(i)).size();
+
+	Common::MemoryWriteStreamDynamic writeStream(true);
+	writer.write(writeStream);
+
+	Common::MemoryReadStream header(writeStream.getData(), 56);
+	header.skip(8);
+
+	header.skip(4);
+	EXPECT_EQ(header.readUint32LE(), kStructCount + 1);
+	header.skip(4);
+	EXPECT_EQ(header.readUint32LE(), kStructCount * 10 + 1);
+	header.skip(4);
+	EXPECT_EQ(header.readUint32LE(), 11);
+	header.skip(4);
+	EXPECT_EQ(header.readUint32LE(), fieldDataSize);
+
+	Aurora::GFF3File gff(new Common::MemoryReadStream(writeStream.getData(), writeStream.size()));
+
+	const Aurora::GFF3List &entries = gff.getTopLevel().getList("Entries");
+	ASSERT_EQ(entries.size(), kStructCount);
+
+	for (uint32_t i = 0; i < kStructCount; i += 9973) {
+		EXPECT_EQ(entries[i]->getUint("ID"), i);
+		EXPECT_EQ(entries[i]->getUint("Unique"), i);
+		EXPECT_STREQ(entries[i]->getString("Name").c_str(), (Common::UString("Name") + Common::composeString(i % 1000)).c_str());
+		EXPECT_STREQ(entries[i]->getString("ResRef").c_str(), (Common::UString("res") + Common::composeString(i % 100)).c_str());
+		EXPECT_EQ(entries[i]->getDouble("Double"), (i % 10) * 0.5);
+		EXPECT_EQ(entries[i]->getSint("Sint32"), -static_cast<int64_t>(i));
+	}
+}
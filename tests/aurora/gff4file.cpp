@@ -2976,6 +2976,34 @@ GTEST_TEST(GFF4StructListsRef, getList) {
 	EXPECT_EQ(list1[0]->getRefCount(), 6);
 }
 
+GTEST_TEST(GFF4StructListsRef, getListLazy) {
+	Aurora::GFF4File gff4(new Common::MemoryReadStream(kGFF4ListsRef), 0xFFFFFFFF, true);
+	const Aurora::GFF4Struct &strct0 = gff4.getTopLevel();
+
+	EXPECT_EQ(strct0.getUint(256), 23);
+
+	const Aurora::GFF4List &list0 = strct0.getList(257);
+	ASSERT_EQ(list0.size(), 3);
+	ASSERT_NE(list0[0], static_cast<const Aurora::GFF4Struct *>(0));
+
+	const Aurora::GFF4List &list1 = list0[0]->getList(513);
+	ASSERT_EQ(list1.size(), 2);
+	ASSERT_NE(list1[0], static_cast<const Aurora::GFF4Struct *>(0));
+
+	EXPECT_EQ(list1[0]->getUint(768), 27);
+	EXPECT_EQ(list1[0], list1[1]);
+
+	// Only the references followed so far are counted
+	EXPECT_EQ(list1[0]->getRefCount(), 2);
+
+	strct0.prefetch();
+
+	EXPECT_EQ(list1[0]->getRefCount(), 6);
+
+	ASSERT_NE(list0[2], static_cast<const Aurora::GFF4Struct *>(0));
+	EXPECT_EQ(list0[2]->getList(513)[1], list1[0]);
+}
+
 // --- GFF4, generics ---
 
 static const byte kGFF4Generic[] = {
@@ -3017,6 +3045,24 @@ GTEST_TEST(GFF4StructGeneric, getGeneric) {
 	EXPECT_THROW(generic1->getGeneric(0), Common::Exception);
 }
 
+GTEST_TEST(GFF4StructGeneric, getGenericLazy) {
+	Aurora::GFF4File gff4(new Common::MemoryReadStream(kGFF4Generic), 0xFFFFFFFF, true);
+	const Aurora::GFF4Struct &strct0 = gff4.getTopLevel();
+
+	const Aurora::GFF4Struct *generic2 = strct0.getGeneric(257);
+	ASSERT_NE(generic2, static_cast<const Aurora::GFF4Struct *>(0));
+
+	const Aurora::GFF4Struct *strct1 = generic2->getStruct(0);
+	ASSERT_NE(strct1, static_cast<const Aurora::GFF4Struct *>(0));
+	EXPECT_EQ(strct1->getUint(512), 24);
+
+	const Aurora::GFF4Struct *generic3 = strct0.getGeneric(258);
+	ASSERT_NE(generic3, static_cast<const Aurora::GFF4Struct *>(0));
+	EXPECT_EQ(generic3->getUint(2), 27);
+
+	EXPECT_EQ(strct0.getGeneric(257), generic2);
+}
+
 // --- GFF4, shared strings ---
 
 static const byte kGFF4Shared[] = {
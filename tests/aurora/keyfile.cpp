@@ -22,10 +22,14 @@
  *  Unit tests for our KEY resource index reader.
  */
 
+#include <memory>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
 
 #include "src/aurora/keyfile.h"
 
@@ -65,6 +69,48 @@ GTEST_TEST(KEYFile10, getResources) {
 	EXPECT_EQ(res[0].resIndex, 1);
 }
 
+GTEST_TEST(KEYFile10, writeIndex) {
+	Common::MemoryReadStream stream(kKEY10File);
+	Aurora::KEYFile key(stream);
+
+	Common::MemoryWriteStreamDynamic index(true);
+	key.writeIndex(index);
+
+	Common::MemoryReadStream indexStream(index.getData(), index.size());
+	std::unique_ptr<Aurora::KEYFile> indexKey(Aurora::KEYFile::readIndex(indexStream));
+
+	EXPECT_EQ(indexKey->getID(), key.getID());
+	EXPECT_EQ(indexKey->getVersion(), key.getVersion());
+
+	const Aurora::KEYFile::BIFList &bifs = indexKey->getBIFs();
+	ASSERT_EQ(bifs.size(), 1);
+
+	EXPECT_STREQ(bifs[0].c_str(), "data/xoreos.bif");
+
+	const Aurora::KEYFile::ResourceList &res = indexKey->getResources();
+	ASSERT_EQ(res.size(), 1);
+
+	EXPECT_STREQ(res[0].name.c_str(), "ozymandias");
+	EXPECT_EQ(res[0].type, Aurora::kFileTypeTXT);
+	EXPECT_EQ(res[0].bifIndex, 0);
+	EXPECT_EQ(res[0].resIndex, 1);
+}
+
+GTEST_TEST(KEYFile10, readIndexBroken) {
+	Common::MemoryReadStream stream(kKEY10File);
+	Aurora::KEYFile key(stream);
+
+	Common::MemoryWriteStreamDynamic index(true);
+	key.writeIndex(index);
+
+	// Claim far more BIFs than the index has room for
+	std::vector<byte> brokenIndex(index.getData(), index.getData() + index.size());
+	brokenIndex[8] = brokenIndex[9] = brokenIndex[10] = brokenIndex[11] = 0xFF;
+
+	Common::MemoryReadStream indexStream(brokenIndex.data(), brokenIndex.size());
+	EXPECT_THROW(Aurora::KEYFile::readIndex(indexStream), Common::Exception);
+}
+
 // --- KEY V1.1 ---
 
 static const byte kKEY11File[] = {
@@ -0,0 +1,213 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our OBB file archive class.
+ */
+
+#include <cstring>
+
+#include <vector>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/memreadstream.h"
+#include "src/common/deflate.h"
+
+#include "src/aurora/obbfile.h"
+
+// Percy Bysshe Shelley's "Ozymandias"
+static const char *kFileData =
+	"I met a traveller from an antique land\n"
+	"Who said: Two vast and trunkless legs of stone\n"
+	"Stand in the desert. Near them, on the sand,\n"
+	"Half sunk, a shattered visage lies, whose frown,\n"
+	"And wrinkled lip, and sneer of cold command,\n"
+	"Tell that its sculptor well those passions read\n"
+	"Which yet survive, stamped on these lifeless things,\n"
+	"The hand that mocked them and the heart that fed:\n"
+	"And on the pedestal these words appear:\n"
+	"'My name is Ozymandias, king of kings:\n"
+	"Look on my works, ye Mighty, and despair!'\n"
+	"Nothing beside remains. Round the decay\n"
+	"Of that colossal wreck, boundless and bare\n"
+	"The lone and level sands stretch far away.";
+
+static const size_t kChunkSize = 4096;
+
+static void writeUint32LE(std::vector<byte> &obb, uint32_t value) {
+	byte data[4];
+	WRITE_LE_UINT32(data, value);
+
+	obb.insert(obb.end(), data, data + 4);
+}
+
+/** Append data as a series of zlib compressed chunks, followed by 16 bytes of meta data. */
+static uint32_t writeChunks(std::vector<byte> &obb, const std::vector<byte> &data) {
+	const uint32_t start = obb.size();
+
+	for (size_t offset = 0; offset < data.size(); offset += kChunkSize) {
+		size_t packedSize = 0;
+		std::unique_ptr<byte[]> packed(Common::compressDeflate(data.data() + offset,
+			MIN<size_t>(data.size() - offset, kChunkSize), packedSize, Common::kWindowBitsMax));
+
+		// OBB chunks use the default compression level, which the zlib header notes
+		packed[1] = 0x9C;
+
+		obb.insert(obb.end(), packed.get(), packed.get() + packedSize);
+	}
+
+	writeUint32LE(obb, start);
+	writeUint32LE(obb, 0);
+	writeUint32LE(obb, 0);
+	writeUint32LE(obb, 0);
+
+	return start;
+}
+
+static void writeEntry(std::vector<byte> &index, const char *name, uint32_t offset, uint32_t size) {
+	writeUint32LE(index, std::strlen(name));
+	writeUint32LE(index, 0);
+
+	index.insert(index.end(), name, name + std::strlen(name));
+
+	writeUint32LE(index, offset);
+	writeUint32LE(index, 0);
+	writeUint32LE(index, size);
+	writeUint32LE(index, 0);
+	writeUint32LE(index, size);
+	writeUint32LE(index, 0);
+}
+
+/** The contents of the first file, spanning several chunks. */
+static std::vector<byte> getLargeFile() {
+	std::vector<byte> data;
+
+	for (size_t i = 0; i < 20; i++)
+		data.insert(data.end(), kFileData, kFileData + std::strlen(kFileData));
+
+	return data;
+}
+
+/** Create an OBB with one large file, one directory and one small file. */
+static std::vector<byte> createOBB() {
+	const std::vector<byte> largeFile = getLargeFile();
+	const std::vector<byte> smallFile(kFileData, kFileData + std::strlen(kFileData));
+
+	std::vector<byte> obb;
+
+	const uint32_t largeOffset = writeChunks(obb, largeFile);
+	const uint32_t smallOffset = writeChunks(obb, smallFile);
+
+	std::vector<byte> index;
+	writeUint32LE(index, 3);
+	writeUint32LE(index, 0);
+
+	writeEntry(index, "large.txt", largeOffset, largeFile.size());
+	writeEntry(index, "dir"      , 0          , 0);
+	writeEntry(index, "small.txt", smallOffset, smallFile.size());
+
+	writeChunks(obb, index);
+
+	return obb;
+}
+
+GTEST_TEST(OBBFile, getResources) {
+	const std::vector<byte> data = createOBB();
+	const Aurora::OBBFile obb(new Common::MemoryReadStream(data.data(), data.size()));
+
+	const Aurora::OBBFile::ResourceList &resources = obb.getResources();
+	ASSERT_EQ(resources.size(), 2);
+
+	Aurora::OBBFile::ResourceList::const_iterator res = resources.begin();
+
+	EXPECT_STREQ(res->name.c_str(), "large");
+	EXPECT_EQ(res->type, Aurora::kFileTypeTXT);
+	EXPECT_EQ(res->index, 0);
+
+	++res;
+
+	EXPECT_STREQ(res->name.c_str(), "small");
+	EXPECT_EQ(res->type, Aurora::kFileTypeTXT);
+	EXPECT_EQ(res->index, 1);
+}
+
+GTEST_TEST(OBBFile, getResource) {
+	const std::vector<byte> data = createOBB();
+	const Aurora::OBBFile obb(new Common::MemoryReadStream(data.data(), data.size()));
+
+	const std::vector<byte> largeFile = getLargeFile();
+	ASSERT_GT(largeFile.size(), 2 * kChunkSize);
+
+	EXPECT_EQ(obb.getResourceSize(0), largeFile.size());
+	EXPECT_EQ(obb.getResourceSize(1), std::strlen(kFileData));
+
+	std::unique_ptr<Common::SeekableReadStream> file0(obb.getResource(0));
+	ASSERT_EQ(file0->size(), largeFile.size());
+
+	for (size_t i = 0; i < largeFile.size(); i++)
+		EXPECT_EQ(file0->readByte(), largeFile[i]) << "At index " << i;
+
+	std::unique_ptr<Common::SeekableReadStream> file1(obb.getResource(1));
+	ASSERT_EQ(file1->size(), std::strlen(kFileData));
+
+	for (size_t i = 0; i < std::strlen(kFileData); i++)
+		EXPECT_EQ(file1->readByte(), kFileData[i]) << "At index " << i;
+}
+
+GTEST_TEST(OBBFile, getResourceStreamSeek) {
+	const std::vector<byte> data = createOBB();
+	const Aurora::OBBFile obb(new Common::MemoryReadStream(data.data(), data.size()));
+
+	const std::vector<byte> largeFile = getLargeFile();
+
+	std::unique_ptr<Common::ReadStream> stream(obb.getResourceStream(0));
+	Common::SeekableReadStream *file = dynamic_cast<Common::SeekableReadStream *>(stream.get());
+	ASSERT_NE(file, static_cast<Common::SeekableReadStream *>(0));
+
+	ASSERT_EQ(file->size(), largeFile.size());
+
+	// Read across a chunk boundary in the last chunk first, then go back
+	static const size_t kPositions[] = { 2 * kChunkSize - 10, 100, kChunkSize, 0 };
+
+	for (size_t i = 0; i < ARRAYSIZE(kPositions); i++) {
+		file->seek(kPositions[i]);
+
+		byte buffer[kChunkSize + 20];
+		const size_t size = MIN<size_t>(sizeof(buffer), largeFile.size() - kPositions[i]);
+
+		ASSERT_EQ(file->read(buffer, size), size);
+
+		for (size_t j = 0; j < size; j++)
+			EXPECT_EQ(buffer[j], largeFile[kPositions[i] + j]) << "At index " << (kPositions[i] + j);
+	}
+
+	file->seek(largeFile.size() - 1);
+	EXPECT_EQ(file->readByte(), largeFile.back());
+
+	byte b;
+	EXPECT_EQ(file->read(&b, 1), 0);
+	EXPECT_TRUE(file->eos());
+
+	EXPECT_THROW(obb.getResourceStream(2), Common::Exception);
+}
@@ -22,6 +22,8 @@
  *  Unit tests for our RIM file archive class.
  */
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "src/common/error.h"
@@ -142,6 +144,33 @@ GTEST_TEST(RIMFile, findResourceName) {
 	EXPECT_EQ(rim.findResource("nope"      , Aurora::kFileTypeBMP), 0xFFFFFFFF);
 }
 
+GTEST_TEST(RIMFile, findResourceNameCase) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kRIMFile);
+	const Aurora::RIMFile rim(stream);
+
+	EXPECT_EQ(rim.findResource("Ozymandias", Aurora::kFileTypeTXT), 0);
+	EXPECT_EQ(rim.findResource("OZYMANDIAS", Aurora::kFileTypeTXT), 0);
+
+	EXPECT_EQ(rim.findResource("OZYMANDIAS", Aurora::kFileTypeBMP), 0xFFFFFFFF);
+}
+
+GTEST_TEST(RIMFile, findResources) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kRIMFile);
+	const Aurora::RIMFile rim(stream);
+
+	std::vector<Aurora::Archive::ResourceName> names;
+	names.push_back(Aurora::Archive::ResourceName("nope"      , Aurora::kFileTypeTXT));
+	names.push_back(Aurora::Archive::ResourceName("ozymandias", Aurora::kFileTypeTXT));
+	names.push_back(Aurora::Archive::ResourceName("ozymandias", Aurora::kFileTypeBMP));
+
+	const std::vector<uint32_t> indices = rim.findResources(names);
+	ASSERT_EQ(indices.size(), 3);
+
+	EXPECT_EQ(indices[0], 0xFFFFFFFF);
+	EXPECT_EQ(indices[1], 0);
+	EXPECT_EQ(indices[2], 0xFFFFFFFF);
+}
+
 GTEST_TEST(RIMFile, getResource) {
 	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kRIMFile);
 	const Aurora::RIMFile rim(stream);
@@ -496,3 +496,44 @@ GTEST_TEST(RIMWriter, WriteMultipleFiles) {
 	delete readStream2;
 	delete readStream3;
 }
+
+GTEST_TEST(RIMWriter, WriteDuplicateFiles) {
+	Common::MemoryReadStream dataStream1(kFileData, true);
+	const size_t kFileDataSize = dataStream1.size();
+
+	const size_t kLogoDataSize = sizeof(kLogoData);
+	Common::MemoryReadStream dataStream2(kLogoData, kLogoDataSize);
+
+	Common::MemoryWriteStreamDynamic writeStream;
+	Aurora::RIMWriter rimWriter(3, writeStream, true);
+	rimWriter.add("ozymandias_1", Aurora::kFileTypeTXT, dataStream1);
+	dataStream1.seek(0);
+	rimWriter.add("ozymandias_2", Aurora::kFileTypeTXT, dataStream1);
+	rimWriter.add("logo", Aurora::kFileTypeBMP, dataStream2);
+
+	EXPECT_EQ(rimWriter.getBytesSaved(), kFileDataSize);
+	EXPECT_EQ(writeStream.size(), 120 + 3 * 32 + kFileDataSize + kLogoDataSize);
+
+	const Aurora::RIMFile rim(new Common::MemoryReadStream(writeStream.getData(), writeStream.size(), true));
+
+	EXPECT_EQ(rim.getResources().size(), 3);
+
+	EXPECT_EQ(rim.findResource("ozymandias_1", Aurora::kFileTypeTXT), 0);
+	EXPECT_EQ(rim.findResource("ozymandias_2", Aurora::kFileTypeTXT), 1);
+	EXPECT_EQ(rim.findResource("logo", Aurora::kFileTypeBMP), 2);
+
+	for (uint32_t i = 0; i < 2; i++) {
+		std::unique_ptr<Common::SeekableReadStream> readStream(rim.getResource(i));
+		ASSERT_EQ(readStream->size(), kFileDataSize);
+
+		std::unique_ptr<byte[]> fileData = std::make_unique<byte[]>(readStream->size());
+		readStream->read(fileData.get(), readStream->size());
+
+		for (size_t j = 0; j < kFileDataSize; ++j) {
+			EXPECT_EQ(fileData[j], kFileData[j]);
+		}
+	}
+
+	std::unique_ptr<Common::SeekableReadStream> readStream(rim.getResource(2));
+	ASSERT_EQ(readStream->size(), kLogoDataSize);
+}
@@ -71,6 +71,11 @@ tests_aurora_test_ndsrom_SOURCES  = tests/aurora/ndsrom.cpp
 tests_aurora_test_ndsrom_LDADD    = $(aurora_LIBS)
 tests_aurora_test_ndsrom_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                   += tests/aurora/test_obbfile
+tests_aurora_test_obbfile_SOURCES  = tests/aurora/obbfile.cpp
+tests_aurora_test_obbfile_LDADD    = $(aurora_LIBS)
+tests_aurora_test_obbfile_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                    += tests/aurora/test_keyfile
 tests_aurora_test_keyfile_SOURCES  = tests/aurora/keyfile.cpp
 tests_aurora_test_keyfile_LDADD    = $(aurora_LIBS)
@@ -116,6 +121,11 @@ tests_aurora_test_erfwriter_SOURCES  = tests/aurora/erfwriter.cpp
 tests_aurora_test_erfwriter_LDADD    = $(aurora_LIBS)
 tests_aurora_test_erfwriter_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                       += tests/aurora/test_erfupdater
+tests_aurora_test_erfupdater_SOURCES  = tests/aurora/erfupdater.cpp
+tests_aurora_test_erfupdater_LDADD    = $(aurora_LIBS)
+tests_aurora_test_erfupdater_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                       += tests/aurora/test_gff3writer
 tests_aurora_test_gff3writer_SOURCES  = tests/aurora/gff3writer.cpp
 tests_aurora_test_gff3writer_LDADD    = $(aurora_LIBS)
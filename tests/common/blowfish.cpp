@@ -23,6 +23,7 @@
  */
 
 #include <vector>
+#include <memory>
 
 #include "gtest/gtest.h"
 
@@ -81,3 +82,37 @@ GTEST_TEST(Blowfish, misalign) {
 
 	EXPECT_THROW(Common::decryptBlowfishEBC(cipherText, key), Common::Exception);
 }
+
+GTEST_TEST(Blowfish, decryptStream) {
+	std::vector<byte> key;
+	createKey(key);
+
+	std::unique_ptr<Common::SeekableReadStream>
+		clearText(Common::createBlowfishDecryptStream(new Common::MemoryReadStream(kCypherText), key));
+	ASSERT_EQ(clearText->size(), ARRAYSIZE(kCypherText));
+
+	for (size_t i = 0; i < ARRAYSIZE(kClearText); i++)
+		EXPECT_EQ(clearText->readByte(), kClearText[i]) << "At index " << i;
+
+	// Reads spanning blocks, starting in the middle of a block
+	byte data[7];
+
+	clearText->seek(5);
+	ASSERT_EQ(clearText->read(data, sizeof(data)), sizeof(data));
+
+	for (size_t i = 0; i < sizeof(data); i++)
+		EXPECT_EQ(data[i], kClearText[5 + i]) << "At index " << i;
+
+	// Read past the end
+	clearText->seek(12);
+	EXPECT_EQ(clearText->read(data, sizeof(data)), 4);
+	EXPECT_TRUE(clearText->eos());
+}
+
+GTEST_TEST(Blowfish, decryptStreamMisalign) {
+	std::vector<byte> key;
+	createKey(key);
+
+	EXPECT_THROW(Common::createBlowfishDecryptStream(new Common::MemoryReadStream(kCypherText, 7), key),
+	             Common::Exception);
+}
@@ -22,6 +22,8 @@
  *  Unit tests for our DEFLATE decompressor (which uses zlib).
  */
 
+#include <memory>
+
 #include "gtest/gtest.h"
 
 #include "src/common/deflate.h"
@@ -139,6 +141,50 @@ GTEST_TEST(DEFLATE, decompressStreamWithoutDecompressedSize) {
 	delete decompressed;
 }
 
+GTEST_TEST(DEFLATE, decompressStreaming) {
+	static const size_t kSizeCompressed   = sizeof(kDataCompressed);
+	static const size_t kSizeDecompressed = strlen(kDataUncompressed);
+
+	// Small frames, to make sure the input is read in several steps
+	std::unique_ptr<Common::ReadStream> decompressed(
+		Common::decompressDeflateStream(new Common::MemoryReadStream(kDataCompressed), kSizeCompressed,
+		                                kSizeDecompressed, Common::kWindowBitsMaxRaw, true, 16));
+	ASSERT_TRUE(decompressed);
+
+	for (size_t i = 0; i < kSizeDecompressed; i++)
+		EXPECT_EQ(decompressed->readByte(), kDataUncompressed[i]) << "At index " << i;
+
+	EXPECT_FALSE(decompressed->eos());
+
+	byte data[16];
+	EXPECT_EQ(decompressed->read(data, sizeof(data)), 0);
+	EXPECT_TRUE(decompressed->eos());
+}
+
+GTEST_TEST(DEFLATE, decompressStreamingFailOutputBig) {
+	static const size_t kSizeCompressed   = sizeof(kDataCompressed);
+	static const size_t kSizeDecompressed = strlen(kDataUncompressed) * 2;
+
+	std::unique_ptr<Common::ReadStream> decompressed(
+		Common::decompressDeflateStream(new Common::MemoryReadStream(kDataCompressed), kSizeCompressed,
+		                                kSizeDecompressed, Common::kWindowBitsMaxRaw));
+
+	std::unique_ptr<byte[]> data = std::make_unique<byte[]>(kSizeDecompressed);
+	EXPECT_THROW(decompressed->read(data.get(), kSizeDecompressed), Common::Exception);
+}
+
+GTEST_TEST(DEFLATE, decompressStreamingFailInputCut) {
+	static const size_t kSizeCompressed   = sizeof(kDataCompressed) / 2;
+	static const size_t kSizeDecompressed = strlen(kDataUncompressed);
+
+	std::unique_ptr<Common::ReadStream> decompressed(
+		Common::decompressDeflateStream(new Common::MemoryReadStream(kDataCompressed, kSizeCompressed),
+		                                kSizeCompressed, kSizeDecompressed, Common::kWindowBitsMaxRaw));
+
+	std::unique_ptr<byte[]> data = std::make_unique<byte[]>(kSizeDecompressed);
+	EXPECT_THROW(decompressed->read(data.get(), kSizeDecompressed), Common::Exception);
+}
+
 GTEST_TEST(DEFLATE, decompressFailOutputSmall) {
 	static const size_t kSizeCompressed   = sizeof(kDataCompressed);
 	static const size_t kSizeDecompressed = strlen(kDataUncompressed) / 2;
@@ -22,6 +22,8 @@
  *  Unit tests for our LZMA decompressor (which uses lzma).
  */
 
+#include <memory>
+
 #include "gtest/gtest.h"
 
 #include "src/common/lzma.h"
@@ -109,6 +111,26 @@ GTEST_TEST(LZMA1, decompressStream) {
 	delete decompressed;
 }
 
+GTEST_TEST(LZMA1, decoderReuse) {
+	static const size_t kSizeCompressed   = sizeof(kDataCompressed);
+	static const size_t kSizeDecompressed = strlen(kDataUncompressed);
+
+	Common::LZMA1Decoder decoder;
+
+	// The decoder stays usable after decompressing, even after failing to
+	for (size_t n = 0; n < 3; n++) {
+		std::unique_ptr<byte[]> decompressed = std::make_unique<byte[]>(kSizeDecompressed);
+
+		decoder.decompress(kDataCompressed, kSizeCompressed, decompressed.get(), kSizeDecompressed);
+
+		for (size_t i = 0; i < kSizeDecompressed; i++)
+			EXPECT_EQ(decompressed[i], kDataUncompressed[i]) << "At index " << i << ", run " << n;
+
+		EXPECT_THROW(decoder.decompress(kDataCompressed, kSizeCompressed / 2,
+		                                decompressed.get(), kSizeDecompressed), Common::Exception);
+	}
+}
+
 GTEST_TEST(LZMA1, decompressFailOutputSmall) {
 	static const size_t kSizeCompressed   = sizeof(kDataCompressed);
 	static const size_t kSizeDecompressed = strlen(kDataUncompressed) / 2;
@@ -132,3 +154,24 @@ GTEST_TEST(LZMA1, decompressFailInputCut) {
 	EXPECT_THROW(Common::decompressLZMA1(kDataCompressed, kSizeCompressed, kSizeDecompressed),
 	             Common::Exception);
 }
+
+GTEST_TEST(LZMA1, compressLarge) {
+	// Large enough that the compressed data doesn't fit into one output block
+	static const size_t kSize = 256 * 1024;
+
+	std::unique_ptr<byte[]> data = std::make_unique<byte[]>(kSize);
+	for (size_t i = 0; i < kSize; i++)
+		data[i] = static_cast<byte>((i * 7) ^ (i >> 5));
+
+	Common::MemoryReadStream input(data.get(), kSize);
+
+	std::unique_ptr<Common::SeekableReadStream> compressed(Common::compressLZMA1(input, kSize));
+	ASSERT_TRUE(compressed);
+
+	std::unique_ptr<Common::SeekableReadStream>
+		decompressed(Common::decompressLZMA1(*compressed, compressed->size(), kSize));
+	ASSERT_EQ(decompressed->size(), kSize);
+
+	for (size_t i = 0; i < kSize; i++)
+		ASSERT_EQ(decompressed->readByte(), data[i]) << "At index " << i;
+}
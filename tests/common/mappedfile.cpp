@@ -0,0 +1,152 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our memory-mapped file read stream.
+ */
+
+#include <memory>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/platform.h"
+#include "src/common/mappedfile.h"
+
+boost::filesystem::path kFilePath;
+
+class MappedFile : public ::testing::Test {
+protected:
+	static void SetUpTestCase() {
+		Common::Platform::init();
+
+		boost::filesystem::path tmpPath    = boost::filesystem::temp_directory_path();
+		boost::filesystem::path uniquePath = boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+		kFilePath = tmpPath / uniquePath;
+
+		static const byte data[5] = { 0x12, 0x34, 0x56, 0x78, 0x90 };
+
+		boost::filesystem::ofstream testFile(kFilePath, std::ofstream::binary);
+
+		testFile.write(reinterpret_cast<const char *>(data), ARRAYSIZE(data));
+		testFile.close();
+	}
+
+	static void TearDownTestCase() {
+		if (!kFilePath.empty())
+			boost::filesystem::remove(kFilePath);
+	}
+};
+
+GTEST_TEST_F(MappedFile, read) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	Common::MappedFile file(kFilePath.generic_string());
+	ASSERT_TRUE(file.isOpen());
+
+	EXPECT_EQ(file.size(), 5);
+
+	byte readData[5];
+	EXPECT_EQ(file.read(readData, sizeof(readData)), 5);
+
+	EXPECT_EQ(readData[0], 0x12);
+	EXPECT_EQ(readData[1], 0x34);
+	EXPECT_EQ(readData[2], 0x56);
+	EXPECT_EQ(readData[3], 0x78);
+	EXPECT_EQ(readData[4], 0x90);
+
+	EXPECT_FALSE(file.eos());
+	EXPECT_EQ(file.read(readData, 1), 0);
+	EXPECT_TRUE(file.eos());
+
+	file.seek(1);
+	EXPECT_EQ(file.readByte(), 0x34);
+
+	EXPECT_EQ(file.getData()[3], 0x78);
+}
+
+GTEST_TEST_F(MappedFile, getSubStream) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	Common::MappedFile file(kFilePath.generic_string());
+	ASSERT_TRUE(file.isOpen());
+
+	std::unique_ptr<Common::SeekableReadStream> subStream(file.getSubStream(1, 4));
+	ASSERT_TRUE(subStream);
+
+	EXPECT_EQ(subStream->size(), 3);
+
+	// The sub stream's position is independent of the file's
+	file.seek(4);
+
+	EXPECT_EQ(subStream->readByte(), 0x34);
+	EXPECT_EQ(subStream->readByte(), 0x56);
+	EXPECT_EQ(subStream->readByte(), 0x78);
+	EXPECT_TRUE(subStream->eos() || (subStream->pos() == subStream->size()));
+
+	EXPECT_EQ(file.readByte(), 0x90);
+
+	EXPECT_THROW(file.getSubStream(3, 2), Common::Exception);
+	EXPECT_THROW(file.getSubStream(0, 6), Common::Exception);
+}
+
+GTEST_TEST_F(MappedFile, readAt) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	Common::MappedFile file(kFilePath.generic_string());
+	ASSERT_TRUE(file.isOpen());
+
+	file.seek(4);
+
+	byte readData[4] = { 0 };
+	EXPECT_EQ(file.readAt(1, readData, 4), 4);
+
+	EXPECT_EQ(readData[0], 0x34);
+	EXPECT_EQ(readData[3], 0x90);
+
+	EXPECT_EQ(file.pos(), 4);
+	EXPECT_EQ(file.readAt(3, readData, 4), 2);
+	EXPECT_THROW(file.readAt(6, readData, 1), Common::Exception);
+}
+
+GTEST_TEST_F(MappedFile, close) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	Common::MappedFile file(kFilePath.generic_string());
+	ASSERT_TRUE(file.isOpen());
+
+	file.close();
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_TRUE(file.eos());
+}
+
+GTEST_TEST(MappedFileMissing, open) {
+	Common::MappedFile file;
+
+	EXPECT_FALSE(file.open("/this/file/does/not/exist.xoreos"));
+	EXPECT_FALSE(file.isOpen());
+
+	EXPECT_THROW(Common::MappedFile("/this/file/does/not/exist.xoreos"), Common::Exception);
+}
@@ -22,6 +22,8 @@
  *  Unit tests for our memory read stream.
  */
 
+#include <memory>
+
 #include "gtest/gtest.h"
 
 #include "src/common/util.h"
@@ -105,6 +107,43 @@ GTEST_TEST(MemoryReadStream, readStream) {
 	EXPECT_THROW(stream.readStream(ARRAYSIZE(data) + 1), Common::Exception);
 }
 
+GTEST_TEST(MemoryReadStream, readAt) {
+	static const byte data[5] = { 0x12, 0x34, 0x56, 0x78, 0x90 };
+	Common::MemoryReadStream stream(data);
+
+	stream.seek(4);
+
+	byte readData[4] = { 0 };
+	EXPECT_EQ(stream.readAt(1, readData, 3), 3);
+
+	EXPECT_EQ(readData[0], 0x34);
+	EXPECT_EQ(readData[1], 0x56);
+	EXPECT_EQ(readData[2], 0x78);
+
+	EXPECT_EQ(stream.pos(), 4);
+	EXPECT_FALSE(stream.eos());
+
+	EXPECT_EQ(stream.readAt(3, readData, 4), 2);
+	EXPECT_EQ(stream.readAt(5, readData, 4), 0);
+	EXPECT_THROW(stream.readAt(6, readData, 1), Common::Exception);
+}
+
+GTEST_TEST(MemoryReadStream, readStreamAt) {
+	static const byte data[5] = { 0x12, 0x34, 0x56, 0x78, 0x90 };
+	Common::MemoryReadStream stream(data);
+
+	std::unique_ptr<Common::MemoryReadStream> streamRead(stream.readStreamAt(2, 3));
+
+	EXPECT_EQ(streamRead->size(), 3);
+	EXPECT_EQ(streamRead->readByte(), 0x56);
+	EXPECT_EQ(streamRead->readByte(), 0x78);
+	EXPECT_EQ(streamRead->readByte(), 0x90);
+
+	EXPECT_EQ(stream.pos(), 0);
+
+	EXPECT_THROW(stream.readStreamAt(2, 4), Common::Exception);
+}
+
 GTEST_TEST(MemoryReadStream, readChar) {
 	static const byte data[3] = { 0x12, 0x34, 0x56 };
 	Common::MemoryReadStream stream(data);
@@ -315,6 +354,54 @@ GTEST_TEST(SeekableSubReadStream, fromMem) {
 	EXPECT_FALSE(subStream.eos());
 }
 
+GTEST_TEST(SeekableSubReadStream, readAt) {
+	static const byte data[5] = { 0x12, 0x34, 0x56, 0x78, 0x90 };
+	Common::MemoryReadStream stream(data);
+
+	Common::SeekableSubReadStream subStream(&stream, 1, 4);
+
+	byte readData[4] = { 0 };
+	EXPECT_EQ(subStream.readAt(1, readData, 4), 2);
+
+	EXPECT_EQ(readData[0], data[2]);
+	EXPECT_EQ(readData[1], data[3]);
+
+	EXPECT_EQ(subStream.pos(), 0);
+	EXPECT_THROW(subStream.readAt(4, readData, 1), Common::Exception);
+}
+
+GTEST_TEST(PositionalSubReadStream, fromMem) {
+	static const byte data[5] = { 0x12, 0x34, 0x56, 0x78, 0x90 };
+	Common::MemoryReadStream stream(data);
+
+	Common::PositionalSubReadStream subStream1(&stream, 1, 4);
+	Common::PositionalSubReadStream subStream2(&stream, 3, 5);
+
+	EXPECT_EQ(subStream1.size(), 3);
+	EXPECT_EQ(subStream2.size(), 2);
+
+	// The sub streams don't move the parent stream, nor each other
+	EXPECT_EQ(subStream2.readByte(), data[3]);
+	EXPECT_EQ(subStream1.readByte(), data[1]);
+	EXPECT_EQ(subStream2.readByte(), data[4]);
+	EXPECT_EQ(stream.pos(), 0);
+
+	byte readData[4] = { 0 };
+	EXPECT_EQ(subStream1.read(readData, 4), 2);
+	EXPECT_TRUE(subStream1.eos());
+
+	EXPECT_EQ(readData[0], data[2]);
+	EXPECT_EQ(readData[1], data[3]);
+
+	EXPECT_EQ(subStream1.seek(1), 3);
+	EXPECT_FALSE(subStream1.eos());
+	EXPECT_EQ(subStream1.pos(), 1);
+	EXPECT_EQ(subStream1.readByte(), data[2]);
+
+	EXPECT_THROW(subStream1.seek(4), Common::Exception);
+	EXPECT_THROW(Common::PositionalSubReadStream(&stream, 3, 6), Common::Exception);
+}
+
 GTEST_TEST(SeekableSubReadStreamEndian, streamEndianLE) {
 	static const byte data[4] = { 0x78, 0x56, 0x34, 0x12 };
 	Common::MemoryReadStream stream(data);
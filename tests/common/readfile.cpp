@@ -24,6 +24,7 @@
 
 #include <string>
 #include <iostream>
+#include <memory>
 
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
@@ -31,6 +32,7 @@
 #include "gtest/gtest.h"
 
 #include "src/common/util.h"
+#include "src/common/error.h"
 #include "src/common/platform.h"
 #include "src/common/readfile.h"
 
@@ -87,3 +89,44 @@ GTEST_TEST_F(ReadFile, write) {
 	for (size_t i = 0; i < ARRAYSIZE(data); i++)
 		EXPECT_EQ(readData[i], data[i]) << "At index " << i;
 }
+
+GTEST_TEST_F(ReadFile, readAt) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	static const byte data[5] = { 0x12, 0x34, 0x56, 0x78, 0x90 };
+
+	boost::filesystem::ofstream testFile(kFilePath, std::ofstream::binary);
+
+	testFile.write(reinterpret_cast<const char *>(data), ARRAYSIZE(data));
+	testFile.close();
+
+	Common::ReadFile file(kFilePath.generic_string());
+	ASSERT_TRUE(file.isOpen());
+
+	file.seek(4);
+
+	byte readData[4] = { 0 };
+	EXPECT_EQ(file.readAt(1, readData, 3), 3);
+
+	EXPECT_EQ(readData[0], 0x34);
+	EXPECT_EQ(readData[1], 0x56);
+	EXPECT_EQ(readData[2], 0x78);
+
+	// Reading at a position doesn't move the file
+	EXPECT_EQ(file.pos(), 4);
+	EXPECT_EQ(file.readByte(), 0x90);
+
+	EXPECT_EQ(file.readAt(3, readData, 4), 2);
+	EXPECT_EQ(file.readAt(5, readData, 4), 0);
+	EXPECT_THROW(file.readAt(6, readData, 1), Common::Exception);
+
+	// Sub streams of the file are independent of each other
+	std::unique_ptr<Common::SeekableReadStream> subStream1(file.getSubStream(0, 2));
+	std::unique_ptr<Common::SeekableReadStream> subStream2(file.getSubStream(2, 5));
+
+	EXPECT_EQ(subStream2->readByte(), 0x56);
+	EXPECT_EQ(subStream1->readByte(), 0x12);
+	EXPECT_EQ(subStream2->readByte(), 0x78);
+	EXPECT_EQ(subStream1->readByte(), 0x34);
+	EXPECT_EQ(subStream2->readByte(), 0x90);
+}
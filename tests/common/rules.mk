@@ -65,6 +65,11 @@ tests_common_test_readfile_SOURCES  = tests/common/readfile.cpp
 tests_common_test_readfile_LDADD    = $(common_LIBS)
 tests_common_test_readfile_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                       += tests/common/test_mappedfile
+tests_common_test_mappedfile_SOURCES  = tests/common/mappedfile.cpp
+tests_common_test_mappedfile_LDADD    = $(common_LIBS)
+tests_common_test_mappedfile_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                      += tests/common/test_writefile
 tests_common_test_writefile_SOURCES  = tests/common/writefile.cpp
 tests_common_test_writefile_LDADD    = $(common_LIBS)
@@ -181,3 +186,13 @@ check_PROGRAMS                   += tests/common/test_string
 tests_common_test_string_SOURCES  = tests/common/string.cpp
 tests_common_test_string_LDADD    = $(common_LIBS)
 tests_common_test_string_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                       += tests/common/test_threadpool
+tests_common_test_threadpool_SOURCES  = tests/common/threadpool.cpp
+tests_common_test_threadpool_LDADD    = $(common_LIBS)
+tests_common_test_threadpool_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                      += tests/common/test_tarwriter
+tests_common_test_tarwriter_SOURCES  = tests/common/tarwriter.cpp
+tests_common_test_tarwriter_LDADD    = $(common_LIBS)
+tests_common_test_tarwriter_CXXFLAGS = $(test_CXXFLAGS)
@@ -0,0 +1,158 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our tar archive writer.
+ */
+
+#include <cstring>
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+
+#include "src/common/tarwriter.h"
+#include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
+#include "src/common/error.h"
+
+static const char *kFileData = "Nothing beside remains.";
+
+static uint64_t readOctal(const byte *field, size_t size) {
+	return std::strtoull(std::string(reinterpret_cast<const char *>(field), size).c_str(), 0, 8);
+}
+
+static uint32_t calculateChecksum(const byte *header) {
+	uint32_t sum = 0;
+	for (size_t i = 0; i < 512; i++)
+		sum += ((i >= 148) && (i < 156)) ? ' ' : header[i];
+
+	return sum;
+}
+
+GTEST_TEST(TarWriter, addFile) {
+	Common::MemoryWriteStreamDynamic tarStream(true);
+	Common::TarWriter tar(tarStream);
+
+	Common::MemoryReadStream file(reinterpret_cast<const byte *>(kFileData), std::strlen(kFileData));
+	tar.add("dir/file.txt", file, std::strlen(kFileData));
+	tar.finish();
+
+	// Header, one data block and two end blocks
+	ASSERT_EQ(tarStream.size(), 4 * 512);
+
+	const byte *header = tarStream.getData();
+
+	EXPECT_STREQ(reinterpret_cast<const char *>(header), "dir/file.txt");
+	EXPECT_EQ(readOctal(header + 124, 12), std::strlen(kFileData));
+	EXPECT_EQ(header[156], '0');
+	EXPECT_STREQ(reinterpret_cast<const char *>(header + 257), "ustar");
+	EXPECT_EQ(readOctal(header + 148, 8), calculateChecksum(header));
+
+	const byte *data = header + 512;
+	EXPECT_EQ(std::memcmp(data, kFileData, std::strlen(kFileData)), 0);
+
+	for (size_t i = std::strlen(kFileData); i < 3 * 512; i++)
+		EXPECT_EQ(data[i], 0) << "At index " << i;
+}
+
+GTEST_TEST(TarWriter, addLongFileName) {
+	Common::MemoryWriteStreamDynamic tarStream(true);
+	Common::TarWriter tar(tarStream);
+
+	const Common::UString dir (std::string(120, 'd').c_str());
+	const Common::UString name(std::string( 90, 'n').c_str());
+
+	Common::MemoryReadStream file(reinterpret_cast<const byte *>(kFileData), std::strlen(kFileData));
+	tar.add(dir + "/" + name, file, std::strlen(kFileData));
+
+	const byte *header = tarStream.getData();
+
+	EXPECT_EQ(std::string(reinterpret_cast<const char *>(header), 100).c_str(), std::string(name.c_str()));
+	EXPECT_EQ(std::string(reinterpret_cast<const char *>(header + 345), 155).c_str(), std::string(dir.c_str()));
+
+	Common::MemoryReadStream file2(reinterpret_cast<const byte *>(kFileData), std::strlen(kFileData));
+	EXPECT_THROW(tar.add(Common::UString(std::string(300, 'x').c_str()), file2, std::strlen(kFileData)),
+	             Common::Exception);
+}
+
+GTEST_TEST(TarWriter, addTruncatedFile) {
+	Common::MemoryWriteStreamDynamic tarStream(true);
+	Common::TarWriter tar(tarStream);
+
+	Common::MemoryReadStream file(reinterpret_cast<const byte *>(kFileData), std::strlen(kFileData));
+	EXPECT_THROW(tar.add("file.txt", file, 1000), Common::Exception);
+
+	// The missing data has been padded, so the archive stays intact
+	EXPECT_EQ(tarStream.size(), 3 * 512);
+}
+
+/** A stream that throws after a certain amount of data has been read. */
+class FailingReadStream : public Common::ReadStream {
+public:
+	FailingReadStream(size_t failAfter) : _failAfter(failAfter), _pos(0) {
+	}
+
+	bool eos() const {
+		return false;
+	}
+
+	size_t read(void *dataPtr, size_t dataSize) {
+		if ((_pos + dataSize) > _failAfter)
+			throw Common::Exception("Corrupt data");
+
+		std::memset(dataPtr, 0xFF, dataSize);
+		_pos += dataSize;
+
+		return dataSize;
+	}
+
+private:
+	size_t _failAfter;
+	size_t _pos;
+};
+
+GTEST_TEST(TarWriter, addFailingFile) {
+	Common::MemoryWriteStreamDynamic tarStream(true);
+	Common::TarWriter tar(tarStream);
+
+	// The first 64 KiB are copied successfully, then reading throws
+	FailingReadStream failing(64 * 1024);
+	EXPECT_THROW(tar.add("failing.bin", failing, 70000), Common::Exception);
+
+	// The entry has been padded out to its full size
+	const size_t failingSize = 512 + ((70000 + 511) / 512) * 512;
+	ASSERT_EQ(tarStream.size(), failingSize);
+
+	for (size_t i = 512 + 64 * 1024; i < failingSize; i++)
+		ASSERT_EQ(tarStream.getData()[i], 0) << "At index " << i;
+
+	// The following file's header lies where tar expects it
+	Common::MemoryReadStream file(reinterpret_cast<const byte *>(kFileData), std::strlen(kFileData));
+	tar.add("file.txt", file, std::strlen(kFileData));
+	tar.finish();
+
+	ASSERT_EQ(tarStream.size(), failingSize + 4 * 512);
+
+	const byte *header = tarStream.getData() + failingSize;
+
+	EXPECT_STREQ(reinterpret_cast<const char *>(header), "file.txt");
+	EXPECT_EQ(readOctal(header + 148, 8), calculateChecksum(header));
+	EXPECT_EQ(std::memcmp(header + 512, kFileData, std::strlen(kFileData)), 0);
+}
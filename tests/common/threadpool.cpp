@@ -0,0 +1,85 @@
+/* xoreos-tools - Tools to help with xoreos development
+ *
+ * xoreos-tools is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos-tools is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our thread pool.
+ */
+
+#include <vector>
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+#include "src/common/threadpool.h"
+#include "src/common/error.h"
+
+GTEST_TEST(ThreadPool, threadCount) {
+	Common::ThreadPool pool(3);
+
+	EXPECT_EQ(pool.getThreadCount(), 3);
+}
+
+GTEST_TEST(ThreadPool, threadCountHardware) {
+	Common::ThreadPool pool;
+
+	EXPECT_EQ(pool.getThreadCount(), Common::ThreadPool::getHardwareThreadCount());
+	EXPECT_GE(pool.getThreadCount(), 1);
+}
+
+GTEST_TEST(ThreadPool, results) {
+	Common::ThreadPool pool(4);
+
+	std::vector<std::future<size_t>> results;
+	for (size_t i = 0; i < 100; i++)
+		results.push_back(pool.addJob([i]() { return i * i; }));
+
+	for (size_t i = 0; i < results.size(); i++)
+		EXPECT_EQ(results[i].get(), i * i) << "At index " << i;
+}
+
+GTEST_TEST(ThreadPool, exception) {
+	Common::ThreadPool pool(2);
+
+	std::future<void> result = pool.addJob([]() { throw Common::Exception("Foobar"); });
+
+	EXPECT_THROW(result.get(), Common::Exception);
+}
+
+GTEST_TEST(ThreadPool, finishOnDestruction) {
+	std::atomic<size_t> count(0);
+
+	{
+		Common::ThreadPool pool(2);
+
+		for (size_t i = 0; i < 50; i++)
+			pool.addJob([&count]() { count++; });
+	}
+
+	EXPECT_EQ(count, 50);
+}
+
+GTEST_TEST(ThreadPool, waitForEarlierJob) {
+	Common::ThreadPool pool(2);
+
+	std::shared_future<size_t> first = pool.addJob([]() { return (size_t) 23; }).share();
+	std::future<size_t> second = pool.addJob([first]() { return first.get() + 19; });
+
+	EXPECT_EQ(second.get(), 42);
+}
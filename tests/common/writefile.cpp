@@ -165,3 +165,39 @@ GTEST_TEST_F(WriteFile, size) {
 	EXPECT_EQ(data[12], 0xCD);
 	EXPECT_EQ(data[13], 0xEF);
 }
+
+GTEST_TEST_F(WriteFile, update) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	Common::WriteFile missingFile;
+	EXPECT_FALSE(missingFile.open(kFilePath.generic_string(), true));
+
+	{
+		Common::WriteFile file(kFilePath.generic_string());
+		file.writeString("Foobar");
+	}
+
+	Common::WriteFile file(kFilePath.generic_string(), true);
+	ASSERT_TRUE(file.isOpen());
+
+	EXPECT_EQ(file.size(), 6);
+	EXPECT_EQ(file.pos(), 0);
+
+	file.seek(3);
+	file.writeString("Baz");
+	file.seek(0, Common::SeekableWriteStream::kOriginEnd);
+	file.writeString("Quux");
+	EXPECT_EQ(file.size(), 10);
+
+	file.flush();
+	file.close();
+
+	// Read back in the file and compare
+
+	boost::filesystem::ifstream testFile(kFilePath, std::ofstream::binary);
+	char data[10];
+	testFile.read(data, 10);
+	ASSERT_FALSE(testFile.fail());
+
+	EXPECT_EQ(std::string(data, 10), "FooBazQuux");
+}
@@ -84,6 +84,30 @@ static const byte kDataCompressed[] = {
 	0x00,0x00,0x00,0xBF,0x01,0x00,0x00,0x00,0x00
 };
 
+// A line of "Ozymandias", stored within a ZIP64 file
+static const char *kDataZIP64Uncompressed = "My name is Ozymandias, king of kings";
+
+static const byte kDataZIP64[] = {
+	0x50,0x4B,0x03,0x04,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x67,
+	0xD8,0x2D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0E,0x00,0x14,0x00,0x6F,0x7A,
+	0x79,0x6D,0x61,0x6E,0x64,0x69,0x61,0x73,0x2E,0x74,0x78,0x74,0x01,0x00,0x10,0x00,
+	0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x4D,0x79,0x20,0x6E,0x61,0x6D,0x65,0x20,0x69,0x73,0x20,0x4F,0x7A,0x79,0x6D,0x61,
+	0x6E,0x64,0x69,0x61,0x73,0x2C,0x20,0x6B,0x69,0x6E,0x67,0x20,0x6F,0x66,0x20,0x6B,
+	0x69,0x6E,0x67,0x73,0x50,0x4B,0x01,0x02,0x2D,0x00,0x2D,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xA7,0x67,0xD8,0x2D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0x0E,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+	0xFF,0xFF,0x6F,0x7A,0x79,0x6D,0x61,0x6E,0x64,0x69,0x61,0x73,0x2E,0x74,0x78,0x74,
+	0x01,0x00,0x18,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x4B,0x06,0x06,
+	0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x00,0x2D,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x50,0x4B,0x06,0x07,0x00,0x00,0x00,0x00,0xBC,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x50,0x4B,0x05,0x06,0x00,0x00,0x00,0x00,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00
+};
+
 GTEST_TEST(ZIPFile, getFiles) {
 	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kDataCompressed);
 	const Common::ZipFile zip(stream);
@@ -124,3 +148,25 @@ GTEST_TEST(ZIPFile, brokenZIP) {
 
 	EXPECT_THROW(Common::ZipFile zip(stream), Common::Exception);
 }
+
+GTEST_TEST(ZIPFile, getFileZIP64) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kDataZIP64);
+	const Common::ZipFile zip(stream);
+
+	const Common::ZipFile::FileList &files = zip.getFiles();
+	ASSERT_EQ(files.size(), 1);
+
+	EXPECT_STREQ(files.begin()->name.c_str(), "ozymandias.txt");
+
+	EXPECT_EQ(zip.getFileSize(0), strlen(kDataZIP64Uncompressed));
+
+	Common::SeekableReadStream *file = zip.getFile(0);
+	ASSERT_NE(file, static_cast<Common::SeekableReadStream *>(0));
+
+	ASSERT_EQ(file->size(), strlen(kDataZIP64Uncompressed));
+
+	for (size_t i = 0; i < strlen(kDataZIP64Uncompressed); i++)
+		EXPECT_EQ(file->readByte(), kDataZIP64Uncompressed[i]) << "At index " << i;
+
+	delete file;
+}
@@ -38,6 +38,7 @@ noinst_HEADERS += \
 include tests/version/rules.mk
 include tests/common/rules.mk
 include tests/aurora/rules.mk
+include tests/archives/rules.mk
 include tests/images/rules.mk
 include tests/xml/rules.mk
 
@@ -236,3 +236,141 @@ GTEST_TEST(XMLParser, getContentEntities) {
 
 	EXPECT_STREQ(ct->getContent().c_str(), "foobar's barfoo");
 }
+
+GTEST_TEST(XMLReader, getRootName) {
+	Common::MemoryReadStream stream(kXML);
+	XML::XMLReader xml(stream);
+
+	EXPECT_STREQ(xml.getName().c_str(), "foo");
+}
+
+GTEST_TEST(XMLReader, readNextStartElement) {
+	Common::MemoryReadStream stream(kXML);
+	XML::XMLReader xml(stream);
+
+	for (size_t i = 0; i < ARRAYSIZE(kFirstChildNodes); i++) {
+		ASSERT_TRUE(xml.readNextStartElement()) << "At index " << i;
+		EXPECT_STREQ(xml.getName().c_str(), kFirstChildNodes[i]) << "At index " << i;
+
+		xml.skipCurrentElement();
+	}
+
+	EXPECT_FALSE(xml.readNextStartElement());
+	EXPECT_FALSE(xml.readNextStartElement());
+}
+
+GTEST_TEST(XMLReader, readNextStartElementNested) {
+	Common::MemoryReadStream stream(kXML);
+	XML::XMLReader xml(stream);
+
+	for (size_t i = 0; i < 4; i++) {
+		ASSERT_TRUE(xml.readNextStartElement());
+		xml.skipCurrentElement();
+	}
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node5");
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node6");
+
+	// node6 has no children, then node5 has no more children
+	EXPECT_FALSE(xml.readNextStartElement());
+	EXPECT_FALSE(xml.readNextStartElement());
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "NoDE7");
+}
+
+GTEST_TEST(XMLReader, makeLower) {
+	Common::MemoryReadStream stream(kXML);
+	XML::XMLReader xml(stream, true);
+
+	for (size_t i = 0; i < 6; i++) {
+		ASSERT_TRUE(xml.readNextStartElement());
+		xml.skipCurrentElement();
+	}
+
+	EXPECT_STREQ(xml.getName().c_str(), "node7");
+}
+
+GTEST_TEST(XMLReader, readElementText) {
+	Common::MemoryReadStream stream(kXML);
+	XML::XMLReader xml(stream);
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node1");
+	EXPECT_STREQ(xml.readElementText().c_str(), "");
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node2");
+	EXPECT_STREQ(xml.readElementText().c_str(), "");
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	xml.skipCurrentElement();
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node4");
+	EXPECT_STREQ(xml.readElementText().c_str(), "blubb");
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node5");
+	EXPECT_STREQ(xml.readElementText().c_str(), "");
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	xml.skipCurrentElement();
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node8");
+	EXPECT_STREQ(xml.readElementText().c_str(), "foobar's barfoo");
+
+	EXPECT_FALSE(xml.readNextStartElement());
+}
+
+GTEST_TEST(XMLReader, getProperties) {
+	Common::MemoryReadStream stream(kXML);
+	XML::XMLReader xml(stream);
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_TRUE(xml.getProperties().empty());
+	xml.skipCurrentElement();
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	xml.skipCurrentElement();
+
+	ASSERT_TRUE(xml.readNextStartElement());
+	EXPECT_STREQ(xml.getName().c_str(), "node3");
+
+	const XML::XMLReader::Properties &props = xml.getProperties();
+	EXPECT_EQ(props.size(), 2);
+
+	EXPECT_STREQ(xml.getProperty("prop1").c_str(), "foo");
+	EXPECT_STREQ(xml.getProperty("prop2").c_str(), "bar");
+	EXPECT_STREQ(xml.getProperty("nope" ).c_str(), "");
+	EXPECT_STREQ(xml.getProperty("nope", "def").c_str(), "def");
+}
+
+GTEST_TEST(XMLReader, parseBroken) {
+	Common::MemoryReadStream stream(kXMLBroken);
+
+	EXPECT_THROW({
+		XML::XMLReader xml(stream);
+
+		while (xml.readNextStartElement())
+			xml.skipCurrentElement();
+	}, Common::Exception);
+}
+
+GTEST_TEST(XMLReader, parseBrokenAfterRoot) {
+	static const char *kXMLTrailing = "<foo><node1/></foo><bar>";
+
+	Common::MemoryReadStream stream(kXMLTrailing);
+
+	// Reaching the end of the root element reads the rest of the document
+	EXPECT_THROW({
+		XML::XMLReader xml(stream);
+
+		while (xml.readNextStartElement())
+			xml.skipCurrentElement();
+	}, Common::Exception);
+}